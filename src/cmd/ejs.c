@@ -34,10 +34,10 @@ static void setupSignals();
     EjsService      *vmService;
     Ejs             *ejs;
     MprList         *useModules, *files;
-    cchar           *cmd, *className, *methodName;
+    cchar           *cmd, *className, *methodName, *profile;
     char            *argp, *searchPath, *modules, *name, *tok, *extraFiles, *spec;
     int             nextArg, err, ecFlags, run, merge, bind, noout, debug, optimizeLevel, warnLevel;
-    int             compilerMode, lang;
+    int             compilerMode, lang, jit;
 
     /*
      *  Create the Embedthis Portable Runtime (MPR) and setup a memory failure handler
@@ -55,12 +55,14 @@ static void setupSignals();
     className = 0;
     cmd = 0;
     methodName = 0;
+    profile = 0;
     searchPath = 0;
     run = 1;
     merge = 0;
     bind = 1;
     noout = 1;
     debug = 1;
+    jit = 0;
     warnLevel = 1;
     optimizeLevel = 9;
     compilerMode = PRAGMA_MODE_STANDARD;
@@ -95,6 +97,9 @@ static void setupSignals();
         } else if (strcmp(argp, "--debug") == 0) {
             debug = 1;
 
+        } else if (strcmp(argp, "--jit") == 0) {
+            jit = 1;
+
         } else if (strcmp(argp, "--lang") == 0) {
             if (nextArg >= argc) {
                 err++;
@@ -149,6 +154,13 @@ static void setupSignals();
                 optimizeLevel = atoi(argv[++nextArg]);
             }
 
+        } else if (strcmp(argp, "--profile") == 0) {
+            if (nextArg >= argc) {
+                err++;
+            } else {
+                profile = argv[++nextArg];
+            }
+
         } else if (strcmp(argp, "-s") == 0) {
             /* Compatibility with mozilla shell. Just ignore */
 
@@ -211,11 +223,13 @@ static void setupSignals();
             "  --cmd ejscriptCode       # Literal ejscript statements to execute\n"
             "  --debug                  # Use symbolic debugging information (default)\n"
             "  --files \"files..\"        # Extra source to compile\n"
+            "  --jit                    # Translate hot functions to specialized byte code\n"
             "  --lang                   # Language compliance (ecma|plus|fixed)\n"
             "  --log logSpec            # Internal compiler diagnostics logging\n"
             "  --method methodName      # Name of method to run. Defaults to main\n"
             "  --nodebug                # Omit symbolic debugging information\n"
             "  --optimize level         # Set the optimization level (0-9 default is 9)\n"
+            "  --profile file           # Save a sampling profile of the script in collapsed stack format\n"
             "  --search ejsPath         # Module search path\n"
             "  --standard               # Default compilation mode to standard (default)\n"
             "  --strict                 # Default compilation mode to strict\n"
@@ -232,7 +246,7 @@ static void setupSignals();
     }
     ecInitCompiler(vmService);
 
-    ejs = ejsCreate(vmService, NULL, searchPath, 0);
+    ejs = ejsCreate(vmService, NULL, searchPath, (jit) ? EJS_FLAG_JIT : 0);
     if (ejs == 0) {
         return MPR_ERR_NO_MEMORY;
     }
@@ -259,6 +273,9 @@ static void setupSignals();
     if (nextArg < argc) {
         mprAddItem(files, argv[nextArg]);
     }
+    if (profile && ejsStartProfiler(ejs, EJS_PROFILE_INTERVAL) < 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
 
     if (cmd) {
         if (interpretCommands(cp, cmd) < 0) {
@@ -276,6 +293,13 @@ static void setupSignals();
             err++;
         }
     }
+    if (profile && ejsWriteProfile(ejs, profile, 0) < 0) {
+        mprError(mpr, "Can't write profile to %s", profile);
+        err++;
+    }
+#if BLD_FEATURE_EJS_OPSTATS
+    ejsPrintOpStats(ejs);
+#endif
 #if VXWORKS
     mprFree(cp);
     mprFree(ejs);
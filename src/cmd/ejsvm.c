@@ -23,7 +23,7 @@ static int  loadModuleFile(Ejs *ejs, char *fileName);
     Mpr             *mpr;
     EjsService      *ejsService;
     Ejs             *ejs; 
-    cchar           *searchPath;
+    cchar           *searchPath, *profile;
     char            *argp, *className, *methodName, **modules, *extraModules, *module;
     int             i, flags, nextArg, err, count;
 
@@ -32,6 +32,7 @@ static int  loadModuleFile(Ejs *ejs, char *fileName);
     methodName = 0;
     extraModules = 0;
     searchPath = 0;
+    profile = 0;
     flags = 0;
 
     /*
@@ -63,6 +64,9 @@ static int  loadModuleFile(Ejs *ejs, char *fileName);
                 className = argv[++nextArg];
             }
 
+        } else if (strcmp(argp, "--jit") == 0) {
+            flags |= EJS_FLAG_JIT;
+
         } else if (strcmp(argp, "--log") == 0) {
             if (nextArg >= argc) {
                 err++;
@@ -84,6 +88,13 @@ static int  loadModuleFile(Ejs *ejs, char *fileName);
                 extraModules = argv[++nextArg];
             }
 
+        } else if (strcmp(argp, "--profile") == 0) {
+            if (nextArg >= argc) {
+                err++;
+            } else {
+                profile = argv[++nextArg];
+            }
+
         } else if (strcmp(argp, "--search") == 0 || strcmp(argp, "--searchpath") == 0) {
             if (nextArg >= argc) {
                 err++;
@@ -110,9 +121,11 @@ static int  loadModuleFile(Ejs *ejs, char *fileName);
             "  Ejscript virtual machine options:\n"
             "  --class className         # Name of class containing method to run\n"
             "                            # Default: first class with main method\n"
+            "  --jit                     # Translate hot functions to specialized byte code\n"
             "  --modules \"modules...\"    # Extra modules to load\n"
             "  --log logSpec             # Internal VM diagnostics logging\n"
             "  --method methodName       # Name of method to run. Default: main\n"
+            "  --profile file            # Save a sampling profile in collapsed stack format\n"
             "  --search ejsPath          # Module search path\n"
             "  --version                 # Emit the compiler version information\n\n", mprGetAppName(mpr));
         return -1;
@@ -124,6 +137,9 @@ static int  loadModuleFile(Ejs *ejs, char *fileName);
         // mprFree(mpr);
         exit(-1);
     }
+    if (profile && ejsStartProfiler(ejs, EJS_PROFILE_INTERVAL) < 0) {
+        exit(-1);
+    }
     
     if (extraModules) {
         mprMakeArgv(ejs, 0, extraModules, &count, &modules);
@@ -148,6 +164,13 @@ static int  loadModuleFile(Ejs *ejs, char *fileName);
     if (!err && ejsRunProgram(ejs, className, methodName) < 0) {
         err++;
     }
+    if (profile && ejsWriteProfile(ejs, profile, 0) < 0) {
+        mprError(mpr, "Can't write profile to %s", profile);
+        err++;
+    }
+#if BLD_FEATURE_EJS_OPSTATS
+    ejsPrintOpStats(ejs);
+#endif
 #if VXWORKS
     mprFree(ejs);
     if (mprStop(mpr)) {
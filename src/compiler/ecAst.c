@@ -45,6 +45,7 @@ static void     astField(EcCompiler *cp, EcNode *np);
 static void     astFor(EcCompiler *cp, EcNode *np);
 static void     astForIn(EcCompiler *cp, EcNode *np);
 static void     astFunction(EcCompiler *cp, EcNode *np);
+static bool     isInlineCandidate(EcCompiler *cp, EcNode *np);
 static void     astHash(EcCompiler *cp, EcNode *np);
 static void     astIf(EcCompiler *cp, EcNode *np);
 static void     astName(EcCompiler *cp, EcNode *np);
@@ -69,6 +70,7 @@ static void     astVoid(EcCompiler *cp, EcNode *np);
 static void     astWarn(EcCompiler *cp, EcNode *np, char *fmt, ...);
 static void     astWith(EcCompiler *cp, EcNode *np);
 static void     badAst(EcCompiler *cp, EcNode *np);
+static void     bindOuterScope(EcCompiler *cp, EcNode *np, bool found);
 static void     bindVariableDefinition(EcCompiler *cp, EcNode *np);
 static void     closeBlock(EcCompiler *cp);
 static EjsNamespace *createHoistNamespace(EcCompiler *cp, EjsVar *obj);
@@ -88,6 +90,7 @@ static void     removeScope(EcCompiler *cp);
 static int      resolveName(EcCompiler *cp, EcNode *node, EjsVar *vp,  EjsName *name);
 static void     setAstDocString(Ejs *ejs, EcNode *np, EjsVar *block616G, int slotNum);
 static EjsNamespace *ejsLookupNamespace(Ejs *ejs, cchar *namespace);
+static void     noteUnboundStore(EcCompiler *cp, EcNode *np);
 
 /*********************************************** Code ***********************************************/
 /*
@@ -191,6 +194,7 @@ static void astArgs(EcCompiler *cp, EcNode *np)
 static void astAssignOp(EcCompiler *cp, EcNode *np)
 {
     EcState     *state;
+    EcNode      *name;
     EjsFunction *fun;
 
     ENTER(cp);
@@ -217,6 +221,18 @@ static void astAssignOp(EcCompiler *cp, EcNode *np)
 
     state->onLeft = 1;
     processAstNode(cp, np->left);
+    noteUnboundStore(cp, np->left);
+
+    if (cp->phase >= EC_PHASE_BIND) {
+        /*
+         *  Functions that are assigned to may change at run time and must not be inlined
+         */
+        name = (np->left->kind == N_DOT) ? np->left->right : np->left;
+        if (name && name->kind == N_QNAME && name->lookup.slotNum >= 0 && name->lookup.ref && 
+                ejsIsFunction(name->lookup.ref) && mprLookupItem(cp->assignedFunctions, name->lookup.ref) < 0) {
+            mprAddItem(cp->assignedFunctions, name->lookup.ref);
+        }
+    }
     LEAVE(cp);
 }
 
@@ -1355,11 +1371,39 @@ static void astFunction(EcCompiler *cp, EcNode *np)
                 }
             }
         }
+        if (cp->optimizeLevel >= EC_OPTIMIZE_CODE && isInlineCandidate(cp, np) && 
+                mprLookupItem(cp->inlineFunctions, np) < 0) {
+            mprAddItem(cp->inlineFunctions, np);
+        }
     }
     LEAVE(cp);
 }
 
 
+/*
+ *  Test if a function is simple enough to be considered for inlining. The body must consist of a single return 
+ *  statement with an expression. The code generator does the remaining checks at each call site.
+ */
+static bool isInlineCandidate(EcCompiler *cp, EcNode *np)
+{
+    EcNode      *body, *ret;
+
+    if (np->function.getter || np->function.setter || np->function.isConstructor || np->function.operatorFn ||
+            np->function.hasRest || np->function.constructorSettings || np->attributes & EJS_ATTR_NATIVE) {
+        return 0;
+    }
+    body = np->function.body;
+    if (body == 0 || body->kind != N_DIRECTIVES || mprGetListCount(body->children) != 2) {
+        return 0;
+    }
+    ret = mprGetItem(body->children, 0);
+    if (ret == 0 || ret->kind != N_RETURN || ret->left == 0) {
+        return 0;
+    }
+    return ((EcNode*) mprGetItem(body->children, 1))->kind == N_END_FUNCTION;
+}
+
+
 /*
  *  Handle a for statement
  */
@@ -1699,6 +1743,7 @@ static void astBindName(EcCompiler *cp, EcNode *np)
                 }
             }
         }
+        bindOuterScope(cp, np, rc >= 0);
     }
 
     if (rc < 0) {
@@ -1780,6 +1825,61 @@ static void astBindName(EcCompiler *cp, EcNode *np)
 }
 
 
+/*
+ *  Count the enclosing function and let blocks that can't define a name so that an unbound reference can skip them 
+ *  at run time. These blocks are fixed when compiled and only gain properties via hoisting which is done before binding.
+ *  Counting stops at the first class, instance, initializer or compiler block as these are dynamic or are not on the
+ *  run time scope chain of nested functions. Blocks are counted as for the nth block in resolveName. A "with" 
+ *  statement opens run time blocks that are not in this scope chain. Code generation may reduce the depth for 
+ *  functions that store undeclared variables (see noteUnboundStore).
+ */
+static void bindOuterScope(EcCompiler *cp, EcNode *np, bool found)
+{
+    Ejs         *ejs;
+    EjsBlock    *block;
+    int         depth;
+
+    ejs = cp->ejs;
+    np->name.outerDepth = 0;
+    np->name.outerScope = 0;
+    if (cp->state->inWith || (found && np->lookup.obj == (EjsVar*) ejs->state->bp)) {
+        return;
+    }
+    depth = 0;
+    for (block = ejs->state->bp->scopeChain; block && block->scopeChain; block = block->scopeChain) {
+        if (found && (EjsVar*) block == np->lookup.obj) {
+            break;
+        }
+        if (block == cp->compilerBlock || ejsIsType(block) || ejsIsInstanceBlock(block) || ejsIsInitializer(block)) {
+            break;
+        }
+        if (!block->obj.var.hidden) {
+            depth++;
+        }
+    }
+    np->name.outerDepth = depth;
+    np->name.outerScope = ejs->state->bp->scopeChain;
+}
+
+
+/*
+ *  At the fixed language level, storing to an undeclared name inside a function creates the variable in the 
+ *  function's frame. Record these functions so that unbound references in nested functions don't skip them.
+ */
+static void noteUnboundStore(EcCompiler *cp, EcNode *np)
+{
+    EjsFunction     *fun;
+
+    fun = cp->state->currentFunction;
+    if (cp->phase < EC_PHASE_BIND || np == 0 || np->kind != N_QNAME || np->lookup.slotNum >= 0 || fun == 0) {
+        return;
+    }
+    if (cp->fileState->lang == EJS_SPEC_FIXED && mprLookupItem(cp->frameStoreFunctions, fun) < 0) {
+        mprAddItem(cp->frameStoreFunctions, fun);
+    }
+}
+
+
 static void astNew(EcCompiler *cp, EcNode *np)
 {
     EjsType     *type;
@@ -1894,6 +1994,7 @@ static void astPostfixOp(EcCompiler *cp, EcNode *np)
         astError(cp, np, "Invalid postfix operand");
     } else {
         processAstNode(cp, np->left);
+        noteUnboundStore(cp, np->left);
     }
     LEAVE(cp);
 }
@@ -2142,6 +2243,9 @@ static void astUnaryOp(EcCompiler *cp, EcNode *np)
         astError(cp, np, "Invalid prefix operand");
     } else {
         processAstNode(cp, np->left);
+        if (np->tokenId == T_PLUS_PLUS || np->tokenId == T_MINUS_MINUS) {
+            noteUnboundStore(cp, np->left);
+        }
     }
     LEAVE(cp);
 }
@@ -2396,6 +2500,7 @@ static void astWith(EcCompiler *cp, EcNode *np)
 
     pushed = 0;
     processAstNode(cp, np->with.object);
+    cp->state->inWith = 1;
 
     if (cp->phase >= EC_PHASE_BIND) {
         processAstNode(cp, np->with.object);
@@ -44,7 +44,9 @@ static void     copyCodeBuffer(EcCompiler *cp, EcCodeGen *dest, EcCodeGen *code)
 static void     createInitializer(EcCompiler *cp, EjsModule *mp);
 static void     discardStackItems(EcCompiler *cp, int preserve);
 static void     emitNamespace(EcCompiler *cp, EjsNamespace *nsp);
+static bool     endsControlFlow(EcCompiler *cp, EcNode *np);
 static int      flushModule(MprFile *file, EcCodeGen *code);
+static EjsVar   *foldConstant(EcCompiler *cp, EcNode *np);
 static void     genBinaryOp(EcCompiler *cp, EcNode *np);
 static void     genBlock(EcCompiler *cp, EcNode *np);
 static void     genBreak(EcCompiler *cp, EcNode *np);
@@ -65,8 +67,10 @@ static void     genForIn(EcCompiler *cp, EcNode *np);
 static void     genFunction(EcCompiler *cp, EcNode *np);
 static void     genHash(EcCompiler *cp, EcNode *np);
 static void     genIf(EcCompiler *cp, EcNode *np);
+static bool     genInlineCall(EcCompiler *cp, EcNode *np);
 static void     genLeftHandSide(EcCompiler *cp, EcNode *np);
 static void     genLiteral(EcCompiler *cp, EcNode *np);
+static void     genLiteralValue(EcCompiler *cp, EcNode *np, EjsVar *vp);
 static void     genLogicalOp(EcCompiler *cp, EcNode *np);
 static void     genModule(EcCompiler *cp, EcNode *np);
 static void     genName(EcCompiler *cp, EcNode *np);
@@ -90,8 +94,16 @@ static void     genVarDefinition(EcCompiler *cp, EcNode *np);
 static void     genWith(EcCompiler *cp, EcNode *np);
 static int      getCodeLength(EcCompiler *cp, EcCodeGen *code);
 static EcNode   *getNextNode(EcCompiler *cp, EcNode *np, int *next);
+static int      getOuterDepth(EcCompiler *cp, EcNode *np);
 static EcNode   *getPrevNode(EcCompiler *cp, EcNode *np, int *next);
 static int      getStackCount(EcCompiler *cp);
+static EjsType  *getStaticType(EcCompiler *cp, EcNode *np);
+static int      getTypedOpcode(EcCompiler *cp, EcNode *np, int opcode);
+static EcNode   *getModuleNode(EcNode *np);
+static bool     isInlineArg(EcCompiler *cp, EcNode *np);
+static bool     isInlineExpression(EcCompiler *cp, EjsFunction *fun, EcNode *np, int *count);
+static bool     isInlineGlobal(EcCompiler *cp, EcNode *np);
+static bool     isRemovable(EcCompiler *cp, EcNode *np);
 static int      mapToken(EcCompiler *cp, EjsOpCode tokenId);
 static MprFile  *openModuleFile(EcCompiler *cp, cchar *filename);
 static void     patchJumps(EcCompiler *cp, int kind, int target);
@@ -102,6 +114,7 @@ static void     pushStack(EcCompiler *cp, int count);
 static void     setCodeBuffer(EcCompiler *cp, EcCodeGen *saveCode);
 static void     setFunctionCode(EcCompiler *cp, EjsFunction *fun, EcCodeGen *code);
 static void     setStack(EcCompiler *cp, int count);
+static void     threadJumps(EcCompiler *cp, uchar *start, int len);
 
 /************************************ Code ************************************/
 /*
@@ -300,6 +313,7 @@ static void genAssignOp(EcCompiler *cp, EcNode *np)
 static void genBinaryOp(EcCompiler *cp, EcNode *np)
 {
     EcState     *state;
+    EjsVar      *value;
 
     ENTER(cp);
 
@@ -315,13 +329,17 @@ static void genBinaryOp(EcCompiler *cp, EcNode *np)
         break;
 
     default:
+        if (cp->optimizeLevel >= EC_OPTIMIZE_CODE && (value = foldConstant(cp, np)) != 0) {
+            genLiteralValue(cp, np, value);
+            break;
+        }
         if (np->left) {
             processNode(cp, np->left);
         }
         if (np->right) {
             processNode(cp, np->right);
         }
-        ecEncodeOpcode(cp, mapToken(cp, np->tokenId));
+        ecEncodeOpcode(cp, getTypedOpcode(cp, np, mapToken(cp, np->tokenId)));
         popStack(cp, 2);
         pushStack(cp, 1);
         break;
@@ -361,12 +379,13 @@ static void genBlock(EcCompiler *cp, EcNode *np)
     EjsBlock        *block;
     EjsLookup       *lookup;
     EcNode          *child;
-    int             next;
+    int             next, unreachable;
 
     ENTER(cp);
 
     state = cp->state;
     block = (EjsBlock*) np->blockRef;
+    unreachable = 0;
     
     if (block && np->createBlockObject) {
         state->prevBlockState = cp->blockState;
@@ -394,7 +413,13 @@ static void genBlock(EcCompiler *cp, EcNode *np)
 
         next = 0;
         while ((child = getNextNode(cp, np, &next))) {
+            if (unreachable && isRemovable(cp, child)) {
+                continue;
+            }
             processNode(cp, child);
+            if (cp->optimizeLevel >= EC_OPTIMIZE_CODE && endsControlFlow(cp, child)) {
+                unreachable = 1;
+            }
         }
         if (lookup->slotNum >= 0) {
             ecEncodeOpcode(cp, EJS_OP_CLOSE_BLOCK);
@@ -405,7 +430,13 @@ static void genBlock(EcCompiler *cp, EcNode *np)
     } else {
         next = 0;
         while ((child = getNextNode(cp, np, &next))) {
+            if (unreachable && isRemovable(cp, child)) {
+                continue;
+            }
             processNode(cp, child);
+            if (cp->optimizeLevel >= EC_OPTIMIZE_CODE && endsControlFlow(cp, child)) {
+                unreachable = 1;
+            }
         }
     }
     LEAVE(cp);
@@ -868,7 +899,7 @@ static void genCallSequence(EcCompiler *cp, EcNode *np)
     EcState         *state;
     EjsFunction     *fun;
     EjsLookup       *lookup;
-    int             fast, argc, staticMethod;    
+    int             fast, argc, staticMethod, depth;    
         
     ejs = cp->ejs;
     state = cp->state;
@@ -883,8 +914,14 @@ static void genCallSequence(EcCompiler *cp, EcNode *np)
          */
         if (left->kind == N_QNAME) {
             argc = genCallArgs(cp, right);
-            ecEncodeOpcode(cp, EJS_OP_CALL_SCOPED_NAME);
-            ecEncodeName(cp, &np->qname);
+            if ((depth = getOuterDepth(cp, left)) > 0) {
+                ecEncodeOpcode(cp, EJS_OP_CALL_OUTER_NAME);
+                ecEncodeName(cp, &np->qname);
+                ecEncodeNumber(cp, depth);
+            } else {
+                ecEncodeOpcode(cp, EJS_OP_CALL_SCOPED_NAME);
+                ecEncodeName(cp, &np->qname);
+            }
             
         } else if (left->kind == N_DOT && left->right->kind == N_QNAME) {
             processNodeGetValue(cp, left->left);
@@ -1088,6 +1125,10 @@ static void genCall(EcCompiler *cp, EcNode *np)
         return;
     }
     
+    if (cp->optimizeLevel >= EC_OPTIMIZE_CODE && genInlineCall(cp, np)) {
+        LEAVE(cp);
+        return;
+    }
     genCallSequence(cp, np);
 
     /*
@@ -1312,19 +1353,26 @@ static void genDirectives(EcCompiler *cp, EcNode *np, bool saveResult)
 {
     EcState     *lastDirectiveState;
     EcNode      *child;
-    int         next, mark;
+    int         next, mark, unreachable;
 
     ENTER(cp);
 
     lastDirectiveState = cp->directiveState;
     next = 0;
     mark = getStackCount(cp);
+    unreachable = 0;
     while ((child = getNextNode(cp, np, &next)) && !cp->error) {
+        if (unreachable && isRemovable(cp, child)) {
+            continue;
+        }
         cp->directiveState = cp->state;
         processNode(cp, child);
         if (!saveResult) {
             discardStackItems(cp, mark);
         }
+        if (cp->optimizeLevel >= EC_OPTIMIZE_CODE && endsControlFlow(cp, child)) {
+            unreachable = 1;
+        }
     }
     if (saveResult) {
         ecEncodeOpcode(cp, EJS_OP_SAVE_RESULT);
@@ -1618,6 +1666,8 @@ static void genFor(EcCompiler *cp, EcNode *np)
 {
     EcCodeGen   *outerBlock, *code;
     EcState     *state;
+    EcNode      *cond;
+    EjsVar      *value;
     int         condLen, bodyLen, perLoopLen, len, condShortJump, perLoopShortJump, continueLabel, breakLabel, mark;
     int         startMark;
 
@@ -1641,14 +1691,19 @@ static void genFor(EcCompiler *cp, EcNode *np)
     }
 
     /*
-     *  For conditional
+     *  For conditional. A conditional that is always true is omitted.
      */
     ecStartBreakableStatement(cp, EC_JUMP_BREAK | EC_JUMP_CONTINUE);
 
-    if (np->forLoop.cond) {
+    cond = np->forLoop.cond;
+    if (cond && cp->optimizeLevel >= EC_OPTIMIZE_CODE && (value = foldConstant(cp, cond)) != 0 &&
+            ejsGetBoolean(ejsCastVar(cp->ejs, value, cp->ejs->booleanType))) {
+        cond = 0;
+    }
+    if (cond) {
         np->forLoop.condCode = state->code = allocCodeBuffer(cp);
         state->needsValue = 1;
-        processNode(cp, np->forLoop.cond);
+        processNode(cp, cond);
         state->needsValue = 0;
         /* Leaves one item on the stack. But this will be cleared when compared */
         mprAssert(state->code->stackCount >= 1);
@@ -2118,7 +2173,9 @@ static void genIf(EcCompiler *cp, EcNode *np)
 {
     EcCodeGen   *saveCode;
     EcState     *state;
-    int         thenLen, elseLen, mark;
+    EcNode      *live, *dead;
+    EjsVar      *cond;
+    int         thenLen, elseLen, mark, thenJump;
 
     ENTER(cp);
 
@@ -2127,6 +2184,37 @@ static void genIf(EcCompiler *cp, EcNode *np)
     state = cp->state;
     saveCode = state->code;
 
+    /*
+     *  If the conditional is constant, only generate the block that can run
+     */
+    if (cp->optimizeLevel >= EC_OPTIMIZE_CODE && (cond = foldConstant(cp, np->tenary.cond)) != 0) {
+        if (ejsGetBoolean(ejsCastVar(cp->ejs, cond, cp->ejs->booleanType))) {
+            live = np->tenary.thenBlock;
+            dead = np->tenary.elseBlock;
+        } else {
+            live = np->tenary.elseBlock;
+            dead = np->tenary.thenBlock;
+        }
+        if (dead == 0 || isRemovable(cp, dead)) {
+            mark = getStackCount(cp);
+            if (live) {
+                state->needsValue = state->prev->needsValue;
+                processNode(cp, live);
+                state->needsValue = 0;
+            }
+            if (state->prev->needsValue) {
+                if (state->code->stackCount != (mark + 1)) {
+                    genError(cp, np, "Expression does not evaluate to a value. Check if operands are void");
+                }
+                discardStackItems(cp, mark + 1);
+            } else {
+                discardStackItems(cp, mark);
+            }
+            LEAVE(cp);
+            return;
+        }
+    }
+
     /*
      *  Process the conditional. 
      */
@@ -2174,11 +2262,18 @@ static void genIf(EcCompiler *cp, EcNode *np)
 
     /*
      *  Calculate jump lengths. Then length will vary depending on if the jump at the end of the "then" block
-     *  can jump over the "else" block with a short jump.
+     *  can jump over the "else" block with a short jump. The jump is not needed if there is no "else" block or if
+     *  the "then" block never completes.
      */
+    thenJump = 1;
+    if (cp->optimizeLevel >= EC_OPTIMIZE_CODE) {
+        thenJump = np->tenary.elseCode && !endsControlFlow(cp, np->tenary.thenBlock);
+    }
     elseLen = (np->tenary.elseCode) ? mprGetBufLength(np->tenary.elseCode->buf) : 0;
     thenLen = mprGetBufLength(np->tenary.thenCode->buf);
-    thenLen += (elseLen < 0x7f && cp->optimizeLevel > 0) ? 2 : 5;
+    if (thenJump) {
+        thenLen += (elseLen < 0x7f && cp->optimizeLevel > 0) ? 2 : 5;
+    }
 
     /*
      *  Now copy the basic blocks into the output code buffer, starting with the jump around the "then" code.
@@ -2201,12 +2296,14 @@ static void genIf(EcCompiler *cp, EcNode *np)
     /*
      *  Create the jump to the end of the if statement
      */
-    if (elseLen < 0x7f && cp->optimizeLevel > 0) {
-        ecEncodeOpcode(cp, EJS_OP_GOTO_8);
-        ecEncodeByte(cp, elseLen);
-    } else {
-        ecEncodeOpcode(cp, EJS_OP_GOTO);
-        ecEncodeWord(cp, elseLen);
+    if (thenJump) {
+        if (elseLen < 0x7f && cp->optimizeLevel > 0) {
+            ecEncodeOpcode(cp, EJS_OP_GOTO_8);
+            ecEncodeByte(cp, elseLen);
+        } else {
+            ecEncodeOpcode(cp, EJS_OP_GOTO);
+            ecEncodeWord(cp, elseLen);
+        }
     }
 
     if (np->tenary.elseCode) {
@@ -2249,6 +2346,15 @@ static void genLeftHandSide(EcCompiler *cp, EcNode *np)
 
 
 static void genLiteral(EcCompiler *cp, EcNode *np)
+{
+    genLiteralValue(cp, np, np->literal.var);
+}
+
+
+/*
+ *  Load a literal value. This is used for literal nodes and for constant expressions folded by the compiler.
+ */
+static void genLiteralValue(EcCompiler *cp, EcNode *np, EjsVar *vp)
 {
     EjsNamespace    *nsp;
     EjsBoolean      *bp;
@@ -2261,11 +2367,11 @@ static void genLiteral(EcCompiler *cp, EcNode *np)
     /*
      *  Map Numbers to the configured real type
      */
-    id = np->literal.var->type->id;
+    id = vp->type->id;
 
     switch (id) {
     case ES_Boolean:
-        bp = (EjsBoolean*) np->literal.var;
+        bp = (EjsBoolean*) vp;
         if (bp->value) {
             ecEncodeOpcode(cp, EJS_OP_LOAD_TRUE);
         } else {
@@ -2277,7 +2383,7 @@ static void genLiteral(EcCompiler *cp, EcNode *np)
         /*
          *  These are signed values
          */
-        ip = (EjsNumber*) np->literal.var;
+        ip = (EjsNumber*) vp;
 #if BLD_FEATURE_FLOATING_POINT
         if (ip->value != floor(ip->value) || ip->value <= -MAXINT || ip->value >= MAXINT) {
             ecEncodeOpcode(cp, EJS_OP_LOAD_DOUBLE);
@@ -2297,7 +2403,7 @@ static void genLiteral(EcCompiler *cp, EcNode *np)
 
     case ES_Namespace:
         ecEncodeOpcode(cp, EJS_OP_LOAD_NAMESPACE);
-        nsp = (EjsNamespace*) np->literal.var;
+        nsp = (EjsNamespace*) vp;
         ecEncodeString(cp, nsp->uri);
         break;
 
@@ -2307,7 +2413,7 @@ static void genLiteral(EcCompiler *cp, EcNode *np)
 
     case ES_String:
         ecEncodeOpcode(cp, EJS_OP_LOAD_STRING);
-        ecEncodeString(cp, ((EjsString*) np->literal.var)->value);
+        ecEncodeString(cp, ((EjsString*) vp)->value);
         break;
 
     case ES_XML:
@@ -2320,7 +2426,7 @@ static void genLiteral(EcCompiler *cp, EcNode *np)
     {
         EjsString *pattern;
         ecEncodeOpcode(cp, EJS_OP_LOAD_REGEXP);
-        pattern = (EjsString*) ejsRegExpToString(cp->ejs, (EjsRegExp*) np->literal.var);
+        pattern = (EjsString*) ejsRegExpToString(cp->ejs, (EjsRegExp*) vp);
         ecEncodeString(cp, pattern->value);
         mprFree(pattern);
         break;
@@ -2345,10 +2451,23 @@ static void genLiteral(EcCompiler *cp, EcNode *np)
  */
 static void genName(EcCompiler *cp, EcNode *np)
 {
+    EcState     *state;
+
     ENTER(cp);
 
     mprAssert(np->kind == N_QNAME || np->kind == N_USE_NAMESPACE);
 
+    state = cp->state;
+    if (state->inlineFunction && np->lookup.obj == (EjsVar*) state->inlineFunction) {
+        /*
+         *  Parameter of a function being inlined. Substitute the call argument. See genInlineCall.
+         */
+        state->inlineFunction = 0;
+        processNode(cp, mprGetItem(state->inlineArgs->children, np->lookup.slotNum));
+        LEAVE(cp);
+        return;
+    }
+
     if (np->needThis) {
         if (np->lookup.useThis) {
             ecEncodeOpcode(cp, EJS_OP_LOAD_THIS);
@@ -2465,7 +2584,7 @@ static void genPostfixOp(EcCompiler *cp, EcNode *np)
      */
     processNode(cp, np->left);
     ecEncodeOpcode(cp, EJS_OP_DUP);
-    ecEncodeOpcode(cp, EJS_OP_INC);
+    ecEncodeOpcode(cp, getTypedOpcode(cp, np, EJS_OP_INC));
     ecEncodeByte(cp, (np->tokenId == T_PLUS_PLUS) ? 1 : -1);
     genLeftHandSide(cp, np->left);
     pushStack(cp, 1);
@@ -2957,11 +3076,19 @@ static void genTry(EcCompiler *cp, EcNode *np)
 
 static void genUnaryOp(EcCompiler *cp, EcNode *np)
 {
+    EjsVar      *value;
+
     ENTER(cp);
 
     mprAssert(np->kind == N_UNARY_OP);
     mprAssert(np->left);
 
+    if (cp->optimizeLevel >= EC_OPTIMIZE_CODE && (value = foldConstant(cp, np)) != 0) {
+        genLiteralValue(cp, np, value);
+        LEAVE(cp);
+        return;
+    }
+
     switch (np->tokenId) {
     case T_DELETE:
         genDelete(cp, np);
@@ -2980,7 +3107,7 @@ static void genUnaryOp(EcCompiler *cp, EcNode *np)
 
     case T_PLUS_PLUS:
         processNode(cp, np->left);
-        ecEncodeOpcode(cp, EJS_OP_INC);
+        ecEncodeOpcode(cp, getTypedOpcode(cp, np, EJS_OP_INC));
         ecEncodeByte(cp, 1);
         ecEncodeOpcode(cp, EJS_OP_DUP);
         pushStack(cp, 1);
@@ -2994,7 +3121,7 @@ static void genUnaryOp(EcCompiler *cp, EcNode *np)
 
     case T_MINUS_MINUS:
         processNode(cp, np->left);
-        ecEncodeOpcode(cp, EJS_OP_INC);
+        ecEncodeOpcode(cp, getTypedOpcode(cp, np, EJS_OP_INC));
         ecEncodeByte(cp, -1);
         ecEncodeOpcode(cp, EJS_OP_DUP);
         pushStack(cp, 1);
@@ -3061,7 +3188,7 @@ static void genUnboundName(EcCompiler *cp, EcNode *np)
     EcState     *state;
     EjsVar      *owner;
     EjsLookup   *lookup;
-    int         code;
+    int         code, depth;
 
     ENTER(cp);
 
@@ -3180,9 +3307,15 @@ static void genUnboundName(EcCompiler *cp, EcNode *np)
             pushStack(cp, 1);
             np->needThis = 0;
         }
-        code = (!state->onLeft) ?  EJS_OP_GET_SCOPED_NAME :  EJS_OP_PUT_SCOPED_NAME;
-        ecEncodeOpcode(cp, code);
-        ecEncodeName(cp, &np->qname);
+        if (!state->onLeft && (depth = getOuterDepth(cp, np)) > 0) {
+            ecEncodeOpcode(cp, EJS_OP_GET_OUTER_NAME);
+            ecEncodeName(cp, &np->qname);
+            ecEncodeNumber(cp, depth);
+        } else {
+            code = (!state->onLeft) ?  EJS_OP_GET_SCOPED_NAME :  EJS_OP_PUT_SCOPED_NAME;
+            ecEncodeOpcode(cp, code);
+            ecEncodeName(cp, &np->qname);
+        }
 
         /*
          *  Store: -1, load: 1
@@ -3410,6 +3543,29 @@ static int getCodeLength(EcCompiler *cp, EcCodeGen *code)
 }
 
 
+/*
+ *  Get the count of lexical blocks an unbound name lookup can skip. The binder counts the blocks that can't define 
+ *  the name. Stop before functions that store undeclared variables in their frame as these are only known once all 
+ *  names are bound.
+ */
+static int getOuterDepth(EcCompiler *cp, EcNode *np)
+{
+    EjsBlock    *block;
+    int         depth;
+
+    depth = 0;
+    for (block = np->name.outerScope; block && depth < np->name.outerDepth; block = block->scopeChain) {
+        if (mprLookupItem(cp->frameStoreFunctions, block) >= 0) {
+            break;
+        }
+        if (!block->obj.var.hidden) {
+            depth++;
+        }
+    }
+    return depth;
+}
+
+
 static void copyCodeBuffer(EcCompiler *cp, EcCodeGen *dest, EcCodeGen *src)
 {
     EjsEx           *exception;
@@ -3620,6 +3776,522 @@ static EcNode *getPrevNode(EcCompiler *cp, EcNode *np, int *next)
 }
 
 
+/*
+ *  Evaluate an expression of number, string and boolean literals at compile time. Returns null if the expression is 
+ *  not constant. The operators are run by the type helpers, so the result is the same as if run by the VM.
+ */
+static EjsVar *foldConstant(EcCompiler *cp, EcNode *np)
+{
+    Ejs         *ejs;
+    EjsVar      *lhs, *rhs, *result;
+    int         id;
+
+    ejs = cp->ejs;
+    result = 0;
+
+    switch (np->kind) {
+    case N_LITERAL:
+        result = np->literal.var;
+        break;
+
+    case N_EXPRESSIONS:
+        if (mprGetListCount(np->children) == 1) {
+            result = foldConstant(cp, np->left);
+        }
+        break;
+
+    case N_BINARY_OP:
+        switch (np->tokenId) {
+        case T_BIT_AND: case T_BIT_OR: case T_BIT_XOR: case T_DIV: case T_EQ: case T_NE: case T_GT: case T_GE:
+        case T_LT: case T_LE: case T_STRICT_EQ: case T_STRICT_NE: case T_LSH: case T_MINUS: case T_MOD: case T_MUL:
+        case T_PLUS: case T_RSH: case T_RSH_ZERO:
+            if ((lhs = foldConstant(cp, np->left)) != 0 && (rhs = foldConstant(cp, np->right)) != 0) {
+                result = ejsInvokeOperator(ejs, lhs, mapToken(cp, np->tokenId), rhs);
+            }
+            break;
+        }
+        break;
+
+    case N_UNARY_OP:
+        if ((lhs = foldConstant(cp, np->left)) == 0) {
+            break;
+        }
+        switch (np->tokenId) {
+        case T_PLUS:
+            result = lhs;
+            break;
+
+        case T_MINUS:
+            result = ejsInvokeOperator(ejs, lhs, EJS_OP_NEG, 0);
+            break;
+
+        case T_TILDE:
+            result = ejsInvokeOperator(ejs, lhs, EJS_OP_NOT, 0);
+            break;
+
+        case T_LOGICAL_NOT:
+            result = ejsInvokeOperator(ejs, ejsCastVar(ejs, lhs, ejs->booleanType), EJS_OP_LOGICAL_NOT, 0);
+            break;
+        }
+        break;
+    }
+    if (ejs->exception) {
+        ejsClearException(ejs);
+        return 0;
+    }
+    if (result == 0) {
+        return 0;
+    }
+    id = result->type->id;
+#if BLD_FEATURE_FLOATING_POINT
+    if (id == ES_Number && ((EjsNumber*) result)->value == 0 && signbit(((EjsNumber*) result)->value)) {
+        /* Negative zero can't be loaded as a literal */
+        return 0;
+    }
+#endif
+    return (id == ES_Number || id == ES_String || id == ES_Boolean) ? result : 0;
+}
+
+
+/*
+ *  Get the type of an expression if it is known at compile time from declared types and literals
+ */
+static EjsType *getStaticType(EcCompiler *cp, EcNode *np)
+{
+    Ejs         *ejs;
+    EjsType     *lhs, *rhs;
+
+    ejs = cp->ejs;
+
+    switch (np->kind) {
+    case N_LITERAL:
+        return np->literal.var->type;
+
+    case N_QNAME:
+        if (np->lookup.slotNum >= 0 && np->lookup.trait) {
+            return np->lookup.trait->type;
+        }
+        break;
+
+    case N_DOT:
+        if (np->right && np->right->kind == N_QNAME) {
+            return getStaticType(cp, np->right);
+        }
+        break;
+
+    case N_EXPRESSIONS:
+        if (mprGetListCount(np->children) == 1) {
+            return getStaticType(cp, np->left);
+        }
+        break;
+
+    case N_BINARY_OP:
+        switch (np->tokenId) {
+        case T_EQ: case T_NE: case T_GT: case T_GE: case T_LT: case T_LE: case T_STRICT_EQ: case T_STRICT_NE:
+            return ejs->booleanType;
+
+        case T_DIV: case T_MINUS: case T_MOD: case T_MUL: case T_PLUS:
+            lhs = getStaticType(cp, np->left);
+            rhs = getStaticType(cp, np->right);
+            if (lhs == ejs->numberType && rhs == ejs->numberType) {
+                return ejs->numberType;
+            } else if (np->tokenId == T_PLUS && lhs == ejs->stringType && rhs == ejs->stringType) {
+                return ejs->stringType;
+            }
+            break;
+        }
+        break;
+
+    case N_UNARY_OP:
+        if (np->tokenId == T_MINUS || np->tokenId == T_PLUS_PLUS || np->tokenId == T_MINUS_MINUS) {
+            if (getStaticType(cp, np->left) == ejs->numberType) {
+                return ejs->numberType;
+            }
+        }
+        break;
+    }
+    return 0;
+}
+
+
+/*
+ *  Generate the body of a small function in place of a call to it. This is done for calls that are bound at
+ *  compile time to functions that can't be overridden: final global functions, static methods called from their own
+ *  class, and final methods called via "this". Other global functions may be rebound at run time. The function
+ *  body must be a single return of an expression that uses only parameters, literals and bound global names.
+ *  Arguments must be free of side effects as they are evaluated once for each use of the parameter. Returns false
+ *  if the call can't be inlined.
+ */
+static bool genInlineCall(EcCompiler *cp, EcNode *np)
+{
+    Ejs             *ejs;
+    EcNode          *left, *args, *fnode, *expr, *arg;
+    EcState         *state;
+    EjsFunction     *fun;
+    EjsLookup       *lookup;
+    EjsTrait        *trait;
+    EjsType         *type;
+    int             next, count, i, final;
+
+    ejs = cp->ejs;
+    state = cp->state;
+    left = np->left;
+    args = np->right;
+    lookup = &left->lookup;
+    fun = (EjsFunction*) lookup->ref;
+
+    if (lookup->slotNum < 0 || fun == 0 || !ejsIsFunction(fun) || ejsIsType(fun)) {
+        return 0;
+    }
+    if (fun->getter || fun->setter || fun->constructor || fun->rest || fun->resultType == ejs->voidType) {
+        return 0;
+    }
+    if (lookup->trait && lookup->trait->attributes & (EJS_ATTR_GETTER | EJS_ATTR_SETTER)) {
+        return 0;
+    }
+    if (np->parent && np->parent->kind == N_DOT && np->parent->right == np) {
+        return 0;
+    }
+
+    /*
+     *  The call must be bound to the function that will run
+     */
+    type = (fun->owner && ejsIsType(fun->owner)) ? (EjsType*) fun->owner : 0;
+    final = (lookup->trait && lookup->trait->attributes & EJS_ATTR_FINAL) || (type && type->final);
+    if (left->kind == N_QNAME) {
+        if (lookup->obj == ejs->global) {
+            if (!final) {
+                return 0;
+            }
+        } else if (fun->staticMethod) {
+            if (!state->currentClass || !state->inFunction || 
+                    !ejsIsA(ejs, (EjsVar*) state->currentClass, (EjsType*) lookup->originalObj)) {
+                return 0;
+            }
+        } else if (!final || !state->inClass || !(ejsIsType(lookup->obj) || ejsIsInstanceBlock(lookup->obj))) {
+            return 0;
+        }
+    } else if (left->kind == N_DOT && left->left->kind == N_THIS && left->left->thisNode.thisKind == 0 &&
+            left->right->kind == N_QNAME) {
+        if (fun->staticMethod || !final) {
+            return 0;
+        }
+    } else {
+        return 0;
+    }
+
+    /*
+     *  Find the function definition. It must be in the same module as the call.
+     */
+    for (next = 0; (fnode = mprGetNextItem(cp->inlineFunctions, &next)) != 0; ) {
+        if (fnode->function.functionVar == fun) {
+            break;
+        }
+    }
+    if (fnode == 0 || getModuleNode(fnode) != getModuleNode(np) || mprLookupItem(cp->assignedFunctions, fun) >= 0) {
+        return 0;
+    }
+    expr = ((EcNode*) mprGetItem(fnode->function.body->children, 0))->left;
+    count = 0;
+    if (!isInlineExpression(cp, fun, expr, &count)) {
+        return 0;
+    }
+    if (fun->resultType && fun->resultType != getStaticType(cp, expr)) {
+        return 0;
+    }
+
+    /*
+     *  Arguments must match the parameter count and declared types
+     */
+    if (args == 0 || mprGetListCount(args->children) != fun->numArgs) {
+        return 0;
+    }
+    for (i = 0; i < fun->numArgs; i++) {
+        arg = mprGetItem(args->children, i);
+        if (!isInlineArg(cp, arg)) {
+            return 0;
+        }
+        trait = ejsGetTrait((EjsBlock*) fun, i);
+        if (trait && trait->type && trait->type != getStaticType(cp, arg)) {
+            return 0;
+        }
+    }
+
+    /*
+     *  Mark the inlined code so that module listings show what was inlined
+     */
+    if (cp->debug && state->code) {
+        ecEncodeOpcode(cp, EJS_OP_DEBUG);
+        ecEncodeString(cp, fnode->filename);
+        ecEncodeNumber(cp, fnode->lineNumber);
+        ecEncodeString(cp, mprStrcat(np, -1, EJS_INLINE_MARKER, fnode->qname.name, NULL));
+    }
+    state->inlineFunction = fun;
+    state->inlineArgs = args;
+    processNodeGetValue(cp, expr);
+    state->inlineFunction = 0;
+    state->inlineArgs = 0;
+    cp->currentLineNumber = -1;
+
+    if (!state->needsValue) {
+        ecEncodeOpcode(cp, EJS_OP_POP);
+        popStack(cp, 1);
+    }
+    return 1;
+}
+
+
+/*
+ *  Test if an expression can be generated outside its function. Parameter references are replaced by the call 
+ *  arguments. Other names must be bound globals as the scope at the call site differs.
+ */
+static bool isInlineExpression(EcCompiler *cp, EjsFunction *fun, EcNode *np, int *count)
+{
+    EcNode      *child;
+    EjsVar      *vp;
+    int         next;
+
+    if (np == 0 || ++*count > EC_INLINE_MAX_NODES) {
+        return 0;
+    }
+    switch (np->kind) {
+    case N_LITERAL:
+        vp = np->literal.var;
+        return vp && (ejsIsNumber(vp) || ejsIsString(vp) || ejsIsBoolean(vp) || ejsIsNull(vp) || ejsIsUndefined(vp));
+
+    case N_QNAME:
+        if (mprGetListCount(np->children) > 0 || np->lookup.slotNum < 0) {
+            return 0;
+        }
+        if (np->lookup.obj == (EjsVar*) fun) {
+            return np->lookup.slotNum < fun->numArgs && np->lookup.nthBlock == 0;
+        }
+        return isInlineGlobal(cp, np);
+
+    case N_DOT:
+        return np->right && np->right->kind == N_QNAME && mprGetListCount(np->right->children) == 0 &&
+            np->right->lookup.slotNum >= 0 && isInlineExpression(cp, fun, np->left, count);
+
+    case N_UNARY_OP:
+        if (np->tokenId == T_DELETE || np->tokenId == T_PLUS_PLUS || np->tokenId == T_MINUS_MINUS) {
+            return 0;
+        }
+        return isInlineExpression(cp, fun, np->left, count);
+
+    case N_BINARY_OP:
+        return isInlineExpression(cp, fun, np->left, count) && isInlineExpression(cp, fun, np->right, count);
+
+    case N_IF:
+        return np->tenary.elseBlock && isInlineExpression(cp, fun, np->tenary.cond, count) && 
+            isInlineExpression(cp, fun, np->tenary.thenBlock, count) &&
+            isInlineExpression(cp, fun, np->tenary.elseBlock, count);
+
+    case N_EXPRESSIONS:
+        next = 0;
+        while ((child = getNextNode(cp, np, &next)) != 0) {
+            if (!isInlineExpression(cp, fun, child, count)) {
+                return 0;
+            }
+        }
+        return next > 0;
+    }
+    return 0;
+}
+
+
+/*
+ *  Test if a call argument can be evaluated any number of times without side effects
+ */
+static bool isInlineArg(EcCompiler *cp, EcNode *np)
+{
+    EjsVar      *vp, *obj;
+
+    switch (np->kind) {
+    case N_LITERAL:
+        vp = np->literal.var;
+        return vp && (ejsIsNumber(vp) || ejsIsString(vp) || ejsIsBoolean(vp) || ejsIsNull(vp) || ejsIsUndefined(vp));
+
+    case N_THIS:
+        return np->thisNode.thisKind == 0;
+
+    case N_QNAME:
+        if (mprGetListCount(np->children) > 0 || np->lookup.slotNum < 0) {
+            return 0;
+        }
+        obj = np->lookup.obj;
+        if ((ejsIsFunction(obj) || ejsIsBlock(obj)) && !ejsIsType(obj) && !ejsIsInstanceBlock(obj) && 
+                obj != cp->ejs->global) {
+            return 1;
+        }
+        return isInlineGlobal(cp, np) && !(np->lookup.trait && np->lookup.trait->attributes & EJS_ATTR_GETTER);
+    }
+    return 0;
+}
+
+
+/*
+ *  Test if a name is a global that is accessed by slot. See genBoundName.
+ */
+static bool isInlineGlobal(EcCompiler *cp, EcNode *np)
+{
+    EjsLookup   *lookup;
+
+    lookup = &np->lookup;
+    return lookup->obj == cp->ejs->global && lookup->slotNum >= 0 && 
+        (cp->bind || (lookup->trait && lookup->trait->attributes & EJS_ATTR_BUILTIN));
+}
+
+
+static EcNode *getModuleNode(EcNode *np)
+{
+    while (np && np->kind != N_MODULE) {
+        np = np->parent;
+    }
+    return np;
+}
+
+
+/*
+ *  Select the number specialized form of an operator if its operands are declared numbers. Strings don't need a
+ *  specialized form as the generic add concatenates strings without calling the type helpers.
+ */
+static int getTypedOpcode(EcCompiler *cp, EcNode *np, int opcode)
+{
+    Ejs     *ejs;
+
+    ejs = cp->ejs;
+    if (cp->optimizeLevel < EC_OPTIMIZE_CODE || getStaticType(cp, np->left) != ejs->numberType) {
+        return opcode;
+    }
+    if (np->kind == N_BINARY_OP && getStaticType(cp, np->right) != ejs->numberType) {
+        return opcode;
+    }
+    return ejsGetNumberOpcode(opcode);
+}
+
+
+/*
+ *  Test if control can never flow past the end of a statement
+ */
+static bool endsControlFlow(EcCompiler *cp, EcNode *np)
+{
+    EjsFunction     *fun;
+    EcNode          *child;
+    int             next;
+
+    switch (np->kind) {
+    case N_BREAK:
+    case N_CONTINUE:
+    case N_THROW:
+        return 1;
+
+    case N_RETURN:
+        /* Void functions ignore return expressions. See genReturn */
+        fun = cp->state->currentFunction;
+        return np->left == 0 || fun == 0 || fun->resultType == NULL || fun->resultType != cp->ejs->voidType;
+
+    case N_BLOCK:
+    case N_DIRECTIVES:
+        next = 0;
+        while ((child = getNextNode(cp, np, &next)) != 0) {
+            if (endsControlFlow(cp, child)) {
+                return 1;
+            }
+        }
+        break;
+
+    case N_IF:
+        return np->tenary.elseBlock && endsControlFlow(cp, np->tenary.thenBlock) && 
+            endsControlFlow(cp, np->tenary.elseBlock);
+    }
+    return 0;
+}
+
+
+/*
+ *  Test if the code for a statement that can never run can be omitted. Declarations must still be generated.
+ */
+static bool isRemovable(EcCompiler *cp, EcNode *np)
+{
+    EcNode      *child;
+    int         next;
+
+    switch (np->kind) {
+    case N_CLASS:
+    case N_END_FUNCTION:
+    case N_FUNCTION:
+    case N_HASH:
+    case N_MODULE:
+    case N_PRAGMA:
+    case N_PRAGMAS:
+    case N_USE_MODULE:
+    case N_USE_NAMESPACE:
+        return 0;
+    }
+    next = 0;
+    while ((child = getNextNode(cp, np, &next)) != 0) {
+        if (!isRemovable(cp, child)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/*
+ *  Redirect jumps that land on an unconditional jump to the final destination. Code length is not changed, so 
+ *  exception tables are unaffected.
+ */
+static void threadJumps(EcCompiler *cp, uchar *start, int len)
+{
+    EjsOptable  *optable;
+    uchar       *pc, *next, *end, *target, *dest, *pos;
+    int         maxOp, kind, offset, count;
+
+    optable = ejsGetOptable(cp);
+    maxOp = ejsGetOpcodeCount(optable);
+    end = &start[len];
+
+    for (pc = start; pc < end; pc = next) {
+        if ((next = ejsGetNextInstruction(optable, maxOp, pc)) == 0) {
+            break;
+        }
+        kind = optable[*pc].args[0];
+        if ((kind != EBC_JMP && kind != EBC_JMP8) || optable[*pc].args[1]) {
+            continue;
+        }
+        if (kind == EBC_JMP) {
+            pos = &pc[1];
+            offset = ejsDecodeWord(&pos);
+        } else {
+            offset = (schar) pc[1];
+        }
+        target = &next[offset];
+        for (count = 0; count < 8 && start <= target && target < end; count++) {
+            if (*target == EJS_OP_GOTO) {
+                pos = &target[1];
+                offset = ejsDecodeWord(&pos);
+                dest = &target[5 + offset];
+            } else if (*target == EJS_OP_GOTO_8) {
+                dest = &target[2 + (schar) target[1]];
+            } else {
+                break;
+            }
+            if (dest == target || (kind == EBC_JMP8 && (dest - next < -0x80 || dest - next > 0x7f))) {
+                break;
+            }
+            target = dest;
+        }
+        offset = (int) (target - next);
+        if (kind == EBC_JMP) {
+            ejsEncodeWordAtPos(&pc[1], offset);
+        } else {
+            pc[1] = (uchar) offset;
+        }
+    }
+}
+
+
 /*
  *  Map a lexical token to an op code
  */
@@ -3714,7 +4386,8 @@ static int mapToken(EcCompiler *cp, EjsOpCode tokenId)
 
 static void addDebugInstructions(EcCompiler *cp, EcNode *np)
 {
-    if (!cp->debug || cp->state->code == 0) {
+    if (!cp->debug || cp->state->code == 0 || cp->state->inlineArgs) {
+        /* Inlined code has a single debug instruction. See genInlineCall */
         return;
     }
     if (np->lineNumber != cp->currentLineNumber) {
@@ -4188,6 +4861,9 @@ static void setFunctionCode(EcCompiler *cp, EjsFunction *fun, EcCodeGen *code)
     mprAssert(len >= 0);
 
     if (len > 0) {
+        if (cp->optimizeLevel >= EC_OPTIMIZE_CODE) {
+            threadJumps(cp, (uchar*) mprGetBufStart(code->buf), len);
+        }
         ejsSetFunctionCode(fun, (uchar*) mprGetBufStart(code->buf), len);
     }
 }
@@ -42,6 +42,7 @@ static EcNode   *createNameNode(EcCompiler *cp, cchar *name, cchar *space);
 static EcNode   *createNamespaceNode(EcCompiler *cp, cchar *name, bool isDefault, bool isLiteral);
 static EcNode   *createNode(EcCompiler *cp, int kind);
 static void     dummy(int junk);
+static void     endCompile(EcCompiler *cp, EcNode **nodes);
 static EcNode   *expected(EcCompiler *cp, const char *str);
 static int      getToken(EcCompiler *cp);
 static EcNode   *insertNode(EcNode *top, EcNode *np, int pos);
@@ -478,6 +479,9 @@ EcCompiler *ecCreateCompiler(Ejs *ejs, int flags, int langLevel)
         mprFree(cp);
         return 0;
     }
+    cp->inlineFunctions = mprCreateList(cp);
+    cp->assignedFunctions = mprCreateList(cp);
+    cp->frameStoreFunctions = mprCreateList(cp);
     cp->lexer = ecCreateLexer(cp);
     if (cp->lexer == 0) {
         mprFree(cp);
@@ -501,6 +505,19 @@ int ecCompile(EcCompiler *cp, int argc, char **argv, int flags)
 }
 
 
+/*
+ *  Release the compiler block, the per-compile function lists and the parsed nodes
+ */
+static void endCompile(EcCompiler *cp, EcNode **nodes)
+{
+    ejsPopBlock(cp->ejs);
+    mprClearList(cp->inlineFunctions);
+    mprClearList(cp->assignedFunctions);
+    mprClearList(cp->frameStoreFunctions);
+    mprFree(nodes);
+}
+
+
 static int compileInner(EcCompiler *cp, int argc, char **argv, int flags)
 {
     Ejs         *ejs;
@@ -582,21 +599,18 @@ static int compileInner(EcCompiler *cp, int argc, char **argv, int flags)
 
         ecResetParser(cp);
         if (ecAstProcess(cp, argc, nodes) < 0) {
-            ejsPopBlock(ejs);
-            mprFree(nodes);
+            endCompile(cp, nodes);
             return EJS_ERR;
         }
         if (cp->errorCount == 0) {
             ecResetParser(cp);
             if (ecCodeGen(cp, argc, nodes) < 0) {
-                ejsPopBlock(ejs);
-                mprFree(nodes);
+                endCompile(cp, nodes);
                 return EJS_ERR;
             }
         }
     }
-    ejsPopBlock(ejs);
-    mprFree(nodes);
+    endCompile(cp, nodes);
     if (cp->errorCount > 0) {
         return EJS_ERR;
     }
@@ -57,12 +57,15 @@ int ecPushState(EcCompiler *cp, EcState *newState)
         newState->disabled = prev->disabled;
         newState->inHashExpression = prev->inHashExpression;
         newState->inSettings = prev->inSettings;
+        newState->inWith = prev->inWith;
         newState->noin = prev->noin;
         newState->blockNestCount = prev->blockNestCount;
         newState->namespace = prev->namespace;
         newState->defaultNamespace = prev->defaultNamespace;
         newState->breakState = prev->breakState;
         newState->inInterface = prev->inInterface;
+        newState->inlineFunction = prev->inlineFunction;
+        newState->inlineArgs = prev->inlineArgs;
 
     } else {
         newState->lang = cp->lang;
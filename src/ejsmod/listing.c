@@ -727,7 +727,15 @@ static void interp(EjsMod *mp, EjsModule *module, EjsFunction *fun)
                 mprFprintf(mp->file, "\n");
             }
             mprSprintf(lineInfo, sizeof(lineInfo), "%s:%d", currentFile, lineNumber);
-            mprFprintf(mp->file, "    # %-25s %s\n", lineInfo, currentLine);
+            if (strncmp(currentLine, EJS_INLINE_MARKER, sizeof(EJS_INLINE_MARKER) - 1) == 0) {
+                /*
+                 *  The compiler marks code generated for an inlined function call. See genInlineCall.
+                 */
+                mprFprintf(mp->file, "    # inlined %s() from %s\n", &currentLine[sizeof(EJS_INLINE_MARKER) - 1], 
+                    lineInfo);
+            } else {
+                mprFprintf(mp->file, "    # %-25s %s\n", lineInfo, currentLine);
+            }
             lastDebug = 1;
         }
     }
@@ -336,8 +336,11 @@ module ejs {
         }
 
         /**
-         *  Sort the array. The array is sorted in lexical order. A compare function may be supplied.
-         *  @param compare Function to use to compare. A null comparator will use a text compare
+         *  Sort the array. The array is sorted in lexical order. A compare function may be supplied. The sort is stable,
+         *  so elements that compare equal keep their relative order.
+         *  @param compare Function to use to compare. It is called with two elements and should return a negative 
+         *      number, zero or a positive number if the first element sorts before, with or after the second.
+         *      A null comparator will use a text compare
          *  @param order If order is >= 0, then an ascending lexical order is used. Otherwise descending.
          *  @return the sorted array reference
          *      type Comparator = (function (*,*): AnyNumber | undefined)
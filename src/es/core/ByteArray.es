@@ -230,6 +230,13 @@ module ejs {
          */
         native function readLong(): Number
 
+        /**
+         *  Read an object written by $writeObject. Data is read from the current read $position pointer.
+         *  @returns an object
+         *  @throws SyntaxError if the data is corrupt.
+         */
+        native function readObject(): Object
+
         /**
          *  Current read position offset
          */
@@ -329,6 +336,13 @@ module ejs {
          */
         native function writeLong(data: Number): Void
 
+        /**
+         *  Write an object to the array using a compact binary encoding. Shared objects and cycles are preserved. 
+         *  Data is written to the current write $position pointer which is then incremented.
+         *  @param obj Object to write
+         */
+        native function writeObject(obj: Object): Void
+
         /**
          *  Current write position offset.
          */
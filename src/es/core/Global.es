@@ -208,7 +208,7 @@ module ejs {
      */
     function dump(...args): Void {
         for each (var e: Object in args) {
-            print(serialize(e))
+            print(serialize(e, 0, false, false, true))
         }
     }
 
@@ -314,16 +314,18 @@ module ejs {
     /**
      *  Encode an object as a string. This function returns a literal string for the object and all its properties. 
      *  If @maxDepth is sufficiently large (or zero for infinite depth), each property will be processed recursively 
-     *  until all properties are rendered.  NOTE: the maxDepth, all and base properties are not yet supported.
+     *  until all properties are rendered. The output is compact without extra whitespace unless @pretty is true.
      *  @param obj Object to serialize
      *  @param maxDepth The depth to recurse when converting properties to literals. If set to zero, the depth is infinite.
      *  @param all Encode non-enumerable and class fixture properties and functions.
      *  @param base Encode base class properties.
+     *  @param pretty Format the output with newlines and indentation.
      *  @return This function returns an object literal that can be used to reinstantiate an object.
      *  @throws TypeError If the object could not be converted to a string.
      *  @spec ejs
      */ 
-    native function serialize(obj: Object, maxDepth: Number = 0, all: Boolean = false, base: Boolean = false): String
+    native function serialize(obj: Object, maxDepth: Number = 0, all: Boolean = false, base: Boolean = false, 
+        pretty: Boolean = false): String
 
     /** @hide  temp only */
     function printHash(name: String, o: Object): Void
@@ -43,6 +43,41 @@ module ejs {
         static function stringify(obj: Object, replacer: Object = null, indent: Number = 0): String
             serialize(obj)
     }
+
+    /**
+     *  Incremental JSON parser. JSON text is written to the parser in chunks as it is read. Each value at the 
+     *  requested nesting depth is parsed as soon as it is complete, passed to a callback and then released. This 
+     *  permits processing documents that are too large to hold in memory as a single string or object.
+     *  @spec ejs
+     *  @stability prototype
+     */
+    class JSONParser {
+
+        use default namespace public
+
+        /**
+         *  Create an incremental JSON parser
+         *  @param callback Function to invoke as callback(value, key) for each completed value. The key is the 
+         *      property name for object members, the index for array elements and null for the top level value.
+         *  @param depth Nesting depth of the values to emit. If zero, the complete document is emitted once it has
+         *      been written. If one, each element or member of the top level array or object is emitted.
+         */
+        native function JSONParser(callback: Function, depth: Number = 1)
+
+        /**
+         *  Write the next chunk of JSON text to the parser
+         *  @param data String or ByteArray containing the text. All available data in a ByteArray is consumed and 
+         *      its read position is advanced.
+         *  @throws SyntaxError if a completed value can't be parsed.
+         */
+        native function write(data: Object): Void
+
+        /**
+         *  Signal the end of input. Any remaining top level value is emitted.
+         *  @throws SyntaxError if the document is incomplete.
+         */
+        native function end(): Void
+    }
 }
 
 
@@ -83,6 +83,12 @@ module ejs.sys {
          */
         native static function noexit(exit: Boolean = true): void
 
+        /**
+         *  Print opcode execution statistics to the log. Reports the count of each opcode and pair of opcodes executed
+         *  and the average CPU cycles per opcode. Requires a build with BLD_FEATURE_EJS_OPSTATS.
+         */
+        native static function opStats(): Void
+
         /**
          *  The application's standard output file stream
          */
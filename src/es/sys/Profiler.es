@@ -0,0 +1,98 @@
+/*
+ *  Profiler.es -- Sampling profiler class
+ *
+ *  Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+module ejs.sys {
+
+    /**
+     *  Sampling profiler for script code. While running, the profiler periodically samples the current call stack.
+     *  Samples are counted for each distinct call stack and can be saved in the collapsed stack format used by
+     *  flame graph tools. Each line of the output is a semicolon separated list of functions, from the outermost call
+     *  to the innermost, followed by the count of samples taken in that call stack. Each function is named by its 
+     *  class and function name and the current source file and line number. Line numbers are only available for 
+     *  code compiled with debug information.
+     *  @spec ejs
+     *  @stability prototype
+     */
+    native class Profiler {
+
+        use default namespace public
+
+        /**
+         *  Is the profiler taking samples
+         */
+        native static function get running(): Boolean
+
+        /**
+         *  Count of samples taken since the profiler was started or reset
+         */
+        native static function get samples(): Number
+
+        /**
+         *  Sampled call stacks in collapsed stack format. Lines are sorted by call stack.
+         */
+        native static function get stacks(): String
+
+        /**
+         *  Discard all samples taken so far
+         */
+        native static function reset(): Void
+
+        /**
+         *  Save the sampled call stacks in collapsed stack format. See $stacks.
+         *  @param path Filename for the profile output. The file is overwritten if it exists.
+         *  @throws IOError if the file can't be written
+         */
+        native static function save(path: String): Void
+
+        /**
+         *  Start sampling. Samples taken by a prior run are preserved. Use $reset to discard them.
+         *  @param interval Number of calls and branches executed between samples. Smaller values give more
+         *      accurate profiles at a higher cost.
+         */
+        native static function start(interval: Number = 1000): Void
+
+        /**
+         *  Stop sampling. The samples taken are preserved.
+         */
+        native static function stop(): Void
+    }
+}
+
+/*
+ *  @copy   default
+ *  
+ *  Copyright (c) Embedthis Software LLC, 2003-2012. All Rights Reserved.
+ *  Copyright (c) Michael O'Brien, 1993-2012. All Rights Reserved.
+ *  
+ *  This software is distributed under commercial and open source licenses.
+ *  You may use the GPL open source license described below or you may acquire 
+ *  a commercial license from Embedthis Software. You agree to be fully bound 
+ *  by the terms of either license. Consult the LICENSE.TXT distributed with 
+ *  this software for full details.
+ *  
+ *  This software is open source; you can redistribute it and/or modify it 
+ *  under the terms of the GNU General Public License as published by the 
+ *  Free Software Foundation; either version 2 of the License, or (at your 
+ *  option) any later version. See the GNU General Public License for more 
+ *  details at: http://www.embedthis.com/downloads/gplLicense.html
+ *  
+ *  This program is distributed WITHOUT ANY WARRANTY; without even the 
+ *  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+ *  
+ *  This GPL license does NOT permit incorporating this software into 
+ *  proprietary programs. If you are unable to comply with the GPL, you must
+ *  acquire a commercial license to use this software. Commercial licenses 
+ *  for this software and support services are available from Embedthis 
+ *  Software at http://www.embedthis.com 
+ *  
+ *  Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
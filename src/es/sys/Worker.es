@@ -60,8 +60,8 @@ module ejs.sys {
         /**
          *  Load the script. The literal script is compiled as a JavaScript program and loaded and run.
          *  This is similar to the global eval() command but the script is run in its own interpreter and does not
-         *  share any data the the invoking interpreter. The result is serialized in the worker and then deserialized
-         *  (using JSON) in the current interpreter. The call returns undefined if the timeout expires.
+         *  share any data the the invoking interpreter. The result is copied into the current interpreter using a 
+         *  structured clone. The call returns undefined if the timeout expires.
          *  @param script Literal JavaScript program string.
          *  @param timeout If the timeout is non-zero, this call blocks and will return the value of the last expression in
          *      the script. Otherwise, this call will not block and join() can be used to wait for completion. Set the
@@ -119,10 +119,14 @@ module ejs.sys {
 
         /**
          *  Post a message to the Worker's parent
-         *  @param data Data to pass to the worker's onmessage callback.
-         *  @param ports Not implemented
+         *  @param data Data to pass to the worker's onmessage callback. The data is copied using a structured clone
+         *      which preserves shared objects, cycles, dates and byte arrays. The callback receives the copy as the 
+         *      event's data property.
+         *  @param transfer Optional array of ByteArrays referenced by data to transfer instead of copying. The 
+         *      contents of transferred ByteArrays are moved to the receiver without copying and the ByteArrays 
+         *      are left empty.
          */
-        native function postMessage(data: Object, ports: Array = null): Void
+        native function postMessage(data: Object, transfer: Array = null): Void
 
         /**
          *  Terminate the worker
@@ -160,10 +164,11 @@ module ejs.sys {
     /**
      *  Post a message to the Worker's parent
      *  @param data Data to pass to the worker's onmessage callback.
+     *  @param transfer Optional array of ByteArrays referenced by data to transfer instead of copying.
      *  This is only valid inside Worker scripts.
      */
-    function postMessage(data: Object): Void
-        self.postMessage(data, null)
+    function postMessage(data: Object, transfer: Array = null): Void
+        self.postMessage(data, transfer)
 
     /**
      *  The error callback function
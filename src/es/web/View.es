@@ -782,7 +782,7 @@ module ejs.web {
         function d(...args): Void {
             write('<pre>\r\n')
             for each (var e: Object in args) {
-                write(serialize(e) + "\r\n")
+                write(serialize(e, 0, false, false, true) + "\r\n")
             }
             write('</pre>\r\n')
         }
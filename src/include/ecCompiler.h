@@ -106,6 +106,8 @@ typedef struct EcNode {
             int         letScope;           /* Variable is defined in let block scope */
             int         instanceVar;        /* Instance or static var (if defined in class) */
             int         isRest;             /* ... rest style args */
+            int         outerDepth;         /* Lexical blocks to skip when looking up an unbound name */
+            EjsBlock    *outerScope;        /* Innermost block of the outerDepth blocks */
             EjsVar      *value;             /* Initialization value */
         } name;
 
@@ -495,6 +497,7 @@ typedef struct EcNode {
 
 #define EC_NUM_NODES                    8
 #define EC_TAB_WIDTH                    4
+#define EC_INLINE_MAX_NODES             16          /* Max expression nodes in a function body to inline */
 
 /*
  *  Fix clash with arpa/nameser.h
@@ -513,6 +516,12 @@ typedef struct EcNode {
 #define EC_FLAGS_RUN             0x40                   /* Code generated will be run immediately */
 #define EC_FLAGS_THROW           0x80                   /* Throw errors when compiling. Used for eval() */
 
+/*
+ *  Optimization levels for ecSetOptimizeLevel()
+ */
+#define EC_OPTIMIZE_JUMPS        1                      /* Use short jumps where possible */
+#define EC_OPTIMIZE_CODE         2                      /* Fold constants, remove dead code and thread jumps */
+
 /*
  *  Lexical tokens (must start at 1)
  *  ASSIGN tokens must be +1 compared to their non-assignment counterparts.
@@ -873,6 +882,7 @@ typedef struct EcState {
     int             blockIsMethod;          /* Current function is a method */
     int             inHashExpression;       /* Inside a # expression */
     int             inSettings;             /* Inside constructor settings */
+    int             inWith;                 /* Inside a with statement */
 
     /*
      *  These are used when parsing
@@ -931,6 +941,9 @@ typedef struct EcState {
     int             inInterface;            /* Inside an interface */
     int             instanceCode;           /* Generating instance class code */
 
+    EjsFunction     *inlineFunction;        /* Function being inlined. Parameter references map to inlineArgs */
+    EcNode          *inlineArgs;            /* Call arguments for the function being inlined */
+
     struct EcState  *prev;                  /* State stack */
     struct EcState  *prevBlockState;        /* Block state stack */
     struct EcState  *breakState;            /* State for breakable blocks */
@@ -1015,6 +1028,9 @@ typedef struct EcCompiler {
 
     MprList     *modules;                   /* List of modules to process */
     MprList     *fixups;                    /* Type reference fixups */
+    MprList     *inlineFunctions;           /* Function nodes that are candidates for inlining */
+    MprList     *assignedFunctions;         /* Functions that are assigned to. These are never inlined */
+    MprList     *frameStoreFunctions;       /* Functions that store undeclared variables in their frame */
 
     char        *ejsPath;                   /* Module file search path */
 
@@ -177,6 +177,6 @@
  */
 #define ES_ejs_events_TimerEvent_NUM_INSTANCE_PROP                     4
 
-#define _ES_CHECKSUM_ejs_events 54233
+#define _ES_CHECKSUM_ejs_events 54234
 
 #endif
@@ -72,8 +72,8 @@
  *    Local slots for methods in type BinaryStream 
  */
 #define ES_ejs_io_BinaryStream_BinaryStream_stream                     0
-#define ES_ejs_io_BinaryStream_BinaryStream___fun_5984__               1
-#define ES_ejs_io_BinaryStream_BinaryStream___fun_6005__               2
+#define ES_ejs_io_BinaryStream_BinaryStream___fun_6039__               1
+#define ES_ejs_io_BinaryStream_BinaryStream___fun_6060__               2
 #define ES_ejs_io_BinaryStream_close_graceful                          0
 #define ES_ejs_io_BinaryStream_set_endian_value                        0
 #define ES_ejs_io_BinaryStream_flush_graceful                          0
@@ -326,7 +326,7 @@
 #define ES_ejs_io_Http_upload_boundary                                 3
 #define ES_ejs_io_Http_upload_buf                                      4
 #define ES_ejs_io_Http_upload_http                                     5
-#define ES_ejs_io_Http_upload___fun_7476__                             6
+#define ES_ejs_io_Http_upload___fun_7531__                             6
 #define ES_ejs_io_Http_upload__hoisted_7_key                           7
 #define ES_ejs_io_Http_upload__hoisted_8_key                           8
 #define ES_ejs_io_Http_set_uri_newUri                                  0
@@ -594,6 +594,6 @@
 #define ES_ejs_io_XMLHttp_callback_hp                                  1
 #define ES_ejs_io_XMLHttp_callback_count                               2
 
-#define _ES_CHECKSUM_ejs_io 354597
+#define _ES_CHECKSUM_ejs_io 354584
 
 #endif
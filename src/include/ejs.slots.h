@@ -50,116 +50,118 @@
 #define ES_Iterable                                                    29
 #define ES_Iterator                                                    30
 #define ES_JSON                                                        31
-#define ES_Math                                                        32
-#define ES_Namespace                                                   33
-#define ES_Reflect                                                     34
-#define ES_typeOf                                                      35
-#define ES_RegExp                                                      36
-#define ES_Stream                                                      37
-#define ES_Type                                                        38
-#define ES_ECMA                                                        39
-#define ES_public                                                      40
-#define ES_internal                                                    41
-#define ES_intrinsic                                                   42
-#define ES_iterator                                                    43
-#define ES_CONFIG                                                      44
-#define ES_TODO                                                        45
-#define ES_FUTURE                                                      46
-#define ES_ASC                                                         47
-#define ES_DOC_ONLY                                                    48
-#define ES_DEPRECATED                                                  49
-#define ES_REGEXP                                                      50
-#define ES_boolean                                                     51
-#define ES_double                                                      52
-#define ES_num                                                         53
-#define ES_string                                                      54
-#define ES_false                                                       55
-#define ES_global                                                      56
-#define ES_null                                                        57
-#define ES_Infinity                                                    58
-#define ES_NegativeInfinity                                            59
-#define ES_NaN                                                         60
-#define ES_StopIteration                                               61
-#define ES_true                                                        62
-#define ES_undefined                                                   63
-#define ES_void                                                        64
-#define ES_assert                                                      65
-#define ES_breakpoint                                                  66
-#define ES_cloneBase                                                   67
-#define ES_deserialize                                                 68
-#define ES_decodeURI                                                   69
-#define ES_dump                                                        70
-#define ES_error                                                       71
-#define ES_escape                                                      72
-#define ES_encodeURI                                                   73
-#define ES_md5                                                         74
-#define ES_eval                                                        75
-#define ES_formatStack                                                 76
-#define ES_hashcode                                                    77
-#define ES_input                                                       78
-#define ES_load                                                        79
-#define ES_output                                                      80
-#define ES_print                                                       81
-#define ES_printv                                                      82
-#define ES_parse                                                       83
-#define ES_serialize                                                   84
-#define ES_printHash                                                   85
-#define ES_instanceOf                                                  86
-#define ES_ejs_events_Event                                            87
-#define ES_ejs_events_ErrorEvent                                       88
-#define ES_ejs_events_Dispatcher                                       89
-#define ES_Endpoint                                                    90
-#define ES_ejs_events_Timer                                            91
-#define ES_ejs_events_TimerEvent                                       92
-#define ES_XML                                                         93
-#define ES_XMLList                                                     94
-#define ES_ejs_io_BinaryStream                                         95
-#define ES_ejs_io_File                                                 96
-#define ES_ejs_io_FileSystem                                           97
-#define ES_ejs_io_Http                                                 98
-#define ES_ejs_io_HttpDataEvent                                        99
-#define ES_ejs_io_HttpErrorEvent                                       100
-#define ES_ejs_io_Path                                                 101
-#define ES_ejs_io_TextStream                                           102
-#define ES_ejs_io_XMLHttp                                              103
-#define ES_ejs_sys_App                                                 104
-#define ES_ejs_sys_Cmd                                                 105
-#define ES_gc                                                          106
-#define ES_readFile                                                    107
-#define ES_ejs_sys_Config                                              108
-#define ES_ejs_sys_GC                                                  109
-#define ES_ejs_sys_Memory                                              110
-#define ES_ejs_sys_System                                              111
-#define ES_basename                                                    112
-#define ES_chdir                                                       113
-#define ES_chmod                                                       114
-#define ES_close                                                       115
-#define ES_cp                                                          116
-#define ES_dirname                                                     117
-#define ES_exists                                                      118
-#define ES_extension                                                   119
-#define ES_isDir                                                       120
-#define ES_kill                                                        121
-#define ES_ls                                                          122
-#define ES_find                                                        123
-#define ES_mkdir                                                       124
-#define ES_mv                                                          125
-#define ES_open                                                        126
-#define ES_pwd                                                         127
-#define ES_read                                                        128
-#define ES_rm                                                          129
-#define ES_rmdir                                                       130
-#define ES_tempname                                                    131
-#define ES_write                                                       132
-#define ES_ejs_sys_Worker                                              133
-#define ES_ejs_sys_worker_self                                         134
-#define ES_ejs_sys_worker_exit                                         135
-#define ES_ejs_sys_worker_postMessage                                  136
-#define ES_ejs_sys_worker_onerror                                      137
-#define ES_ejs_sys_worker_set_onerror                                  138
-#define ES_ejs_sys_worker_onmessage                                    139
-#define ES_ejs_sys_worker_set_onmessage                                140
-#define ES_global_NUM_CLASS_PROP                                       141
+#define ES_JSONParser                                                  32
+#define ES_Math                                                        33
+#define ES_Namespace                                                   34
+#define ES_Reflect                                                     35
+#define ES_typeOf                                                      36
+#define ES_RegExp                                                      37
+#define ES_Stream                                                      38
+#define ES_Type                                                        39
+#define ES_ECMA                                                        40
+#define ES_public                                                      41
+#define ES_internal                                                    42
+#define ES_intrinsic                                                   43
+#define ES_iterator                                                    44
+#define ES_CONFIG                                                      45
+#define ES_TODO                                                        46
+#define ES_FUTURE                                                      47
+#define ES_ASC                                                         48
+#define ES_DOC_ONLY                                                    49
+#define ES_DEPRECATED                                                  50
+#define ES_REGEXP                                                      51
+#define ES_boolean                                                     52
+#define ES_double                                                      53
+#define ES_num                                                         54
+#define ES_string                                                      55
+#define ES_false                                                       56
+#define ES_global                                                      57
+#define ES_null                                                        58
+#define ES_Infinity                                                    59
+#define ES_NegativeInfinity                                            60
+#define ES_NaN                                                         61
+#define ES_StopIteration                                               62
+#define ES_true                                                        63
+#define ES_undefined                                                   64
+#define ES_void                                                        65
+#define ES_assert                                                      66
+#define ES_breakpoint                                                  67
+#define ES_cloneBase                                                   68
+#define ES_deserialize                                                 69
+#define ES_decodeURI                                                   70
+#define ES_dump                                                        71
+#define ES_error                                                       72
+#define ES_escape                                                      73
+#define ES_encodeURI                                                   74
+#define ES_md5                                                         75
+#define ES_eval                                                        76
+#define ES_formatStack                                                 77
+#define ES_hashcode                                                    78
+#define ES_input                                                       79
+#define ES_load                                                        80
+#define ES_output                                                      81
+#define ES_print                                                       82
+#define ES_printv                                                      83
+#define ES_parse                                                       84
+#define ES_serialize                                                   85
+#define ES_printHash                                                   86
+#define ES_instanceOf                                                  87
+#define ES_ejs_events_Event                                            88
+#define ES_ejs_events_ErrorEvent                                       89
+#define ES_ejs_events_Dispatcher                                       90
+#define ES_Endpoint                                                    91
+#define ES_ejs_events_Timer                                            92
+#define ES_ejs_events_TimerEvent                                       93
+#define ES_XML                                                         94
+#define ES_XMLList                                                     95
+#define ES_ejs_io_BinaryStream                                         96
+#define ES_ejs_io_File                                                 97
+#define ES_ejs_io_FileSystem                                           98
+#define ES_ejs_io_Http                                                 99
+#define ES_ejs_io_HttpDataEvent                                        100
+#define ES_ejs_io_HttpErrorEvent                                       101
+#define ES_ejs_io_Path                                                 102
+#define ES_ejs_io_TextStream                                           103
+#define ES_ejs_io_XMLHttp                                              104
+#define ES_ejs_sys_App                                                 105
+#define ES_ejs_sys_Cmd                                                 106
+#define ES_gc                                                          107
+#define ES_readFile                                                    108
+#define ES_ejs_sys_Config                                              109
+#define ES_ejs_sys_GC                                                  110
+#define ES_ejs_sys_Memory                                              111
+#define ES_ejs_sys_Profiler                                            112
+#define ES_ejs_sys_System                                              113
+#define ES_basename                                                    114
+#define ES_chdir                                                       115
+#define ES_chmod                                                       116
+#define ES_close                                                       117
+#define ES_cp                                                          118
+#define ES_dirname                                                     119
+#define ES_exists                                                      120
+#define ES_extension                                                   121
+#define ES_isDir                                                       122
+#define ES_kill                                                        123
+#define ES_ls                                                          124
+#define ES_find                                                        125
+#define ES_mkdir                                                       126
+#define ES_mv                                                          127
+#define ES_open                                                        128
+#define ES_pwd                                                         129
+#define ES_read                                                        130
+#define ES_rm                                                          131
+#define ES_rmdir                                                       132
+#define ES_tempname                                                    133
+#define ES_write                                                       134
+#define ES_ejs_sys_Worker                                              135
+#define ES_ejs_sys_worker_self                                         136
+#define ES_ejs_sys_worker_exit                                         137
+#define ES_ejs_sys_worker_postMessage                                  138
+#define ES_ejs_sys_worker_onerror                                      139
+#define ES_ejs_sys_worker_set_onerror                                  140
+#define ES_ejs_sys_worker_onmessage                                    141
+#define ES_ejs_sys_worker_set_onmessage                                142
+#define ES_global_NUM_CLASS_PROP                                       143
 
 /**
  * Instance slots for "global" type 
@@ -195,6 +197,7 @@
 #define ES_serialize_maxDepth                                          1
 #define ES_serialize_all                                               2
 #define ES_serialize_base                                              3
+#define ES_serialize_pretty                                            4
 #define ES_printHash_name                                              0
 #define ES_printHash_o                                                 1
 #define ES_instanceOf_obj                                              0
@@ -239,6 +242,7 @@
 #define ES_write_file                                                  0
 #define ES_write_items                                                 1
 #define ES_ejs_sys_worker_postMessage_data                             0
+#define ES_ejs_sys_worker_postMessage_transfer                         1
 #define ES_ejs_sys_worker_set_onerror_fun                              0
 #define ES_ejs_sys_worker_set_onmessage_fun                            0
 
@@ -604,22 +608,24 @@
 #define ES_ByteArray_readDouble                                        26
 #define ES_ByteArray_readInteger                                       27
 #define ES_ByteArray_readLong                                          28
-#define ES_ByteArray_readPosition                                      29
-#define ES_ByteArray_set_readPosition                                  30
-#define ES_ByteArray_readShort                                         31
-#define ES_ByteArray_readString                                        32
-#define ES_ByteArray_readXML                                           33
-#define ES_ByteArray_reset                                             34
-#define ES_ByteArray_room                                              35
-#define ES_ByteArray_write                                             36
-#define ES_ByteArray_writeByte                                         37
-#define ES_ByteArray_writeShort                                        38
-#define ES_ByteArray_writeDouble                                       39
-#define ES_ByteArray_writeInteger                                      40
-#define ES_ByteArray_writeLong                                         41
-#define ES_ByteArray_writePosition                                     42
-#define ES_ByteArray_set_writePosition                                 43
-#define ES_ByteArray_NUM_CLASS_PROP                                    44
+#define ES_ByteArray_readObject                                        29
+#define ES_ByteArray_readPosition                                      30
+#define ES_ByteArray_set_readPosition                                  31
+#define ES_ByteArray_readShort                                         32
+#define ES_ByteArray_readString                                        33
+#define ES_ByteArray_readXML                                           34
+#define ES_ByteArray_reset                                             35
+#define ES_ByteArray_room                                              36
+#define ES_ByteArray_write                                             37
+#define ES_ByteArray_writeByte                                         38
+#define ES_ByteArray_writeShort                                        39
+#define ES_ByteArray_writeDouble                                       40
+#define ES_ByteArray_writeInteger                                      41
+#define ES_ByteArray_writeLong                                         42
+#define ES_ByteArray_writeObject                                       43
+#define ES_ByteArray_writePosition                                     44
+#define ES_ByteArray_set_writePosition                                 45
+#define ES_ByteArray_NUM_CLASS_PROP                                    46
 
 /**
  * Instance slots for "ByteArray" type 
@@ -656,6 +662,7 @@
 #define ES_ByteArray_writeDouble_data                                  0
 #define ES_ByteArray_writeInteger_data                                 0
 #define ES_ByteArray_writeLong_data                                    0
+#define ES_ByteArray_writeObject_obj                                   0
 #define ES_ByteArray_set_writePosition_position                        0
 
 
@@ -1135,6 +1142,29 @@
 #define ES_JSON_stringify_indent                                       2
 
 
+/**
+ *   Class property slots for the "JSONParser" class 
+ */
+#define ES_JSONParser__origin                                          6
+#define ES_JSONParser_JSONParser                                       6
+#define ES_JSONParser_write                                            7
+#define ES_JSONParser_end                                              8
+#define ES_JSONParser_NUM_CLASS_PROP                                   9
+
+/**
+ * Instance slots for "JSONParser" type 
+ */
+#define ES_JSONParser_NUM_INSTANCE_PROP                                0
+
+/**
+ * 
+ *    Local slots for methods in type JSONParser 
+ */
+#define ES_JSONParser_JSONParser_callback                              0
+#define ES_JSONParser_JSONParser_depth                                 1
+#define ES_JSONParser_write_data                                       0
+
+
 /**
  *   Class property slots for the "Math" class 
  */
@@ -1383,6 +1413,6 @@
 #define ES_XMLList_attribute_name                                      0
 #define ES_XMLList_elements_name                                       0
 
-#define _ES_CHECKSUM_ejs 484624
+#define _ES_CHECKSUM_ejs 492495
 
 #endif
@@ -44,15 +44,16 @@
 #define ES_ejs_sys_App_inputStream                                     14
 #define ES_ejs_sys_App_name                                            15
 #define ES_ejs_sys_App_noexit                                          16
-#define ES_ejs_sys_App_outputStream                                    17
-#define ES_ejs_sys_App_putenv                                          18
-#define ES_ejs_sys_App_searchPath                                      19
-#define ES_ejs_sys_App_set_searchPath                                  20
-#define ES_ejs_sys_App_serviceEvents                                   21
-#define ES_ejs_sys_App_sleep                                           22
-#define ES_ejs_sys_App_title                                           23
-#define ES_ejs_sys_App_version                                         24
-#define ES_ejs_sys_App_NUM_CLASS_PROP                                  25
+#define ES_ejs_sys_App_opStats                                         17
+#define ES_ejs_sys_App_outputStream                                    18
+#define ES_ejs_sys_App_putenv                                          19
+#define ES_ejs_sys_App_searchPath                                      20
+#define ES_ejs_sys_App_set_searchPath                                  21
+#define ES_ejs_sys_App_serviceEvents                                   22
+#define ES_ejs_sys_App_sleep                                           23
+#define ES_ejs_sys_App_title                                           24
+#define ES_ejs_sys_App_version                                         25
+#define ES_ejs_sys_App_NUM_CLASS_PROP                                  26
 
 /**
  * Instance slots for "App" type 
@@ -198,6 +199,32 @@
 #define ES_ejs_sys_Memory_set_redline_value                            0
 
 
+/**
+ *   Class property slots for the "Profiler" class 
+ */
+#define ES_ejs_sys_Profiler__origin                                    6
+#define ES_ejs_sys_Profiler_running                                    6
+#define ES_ejs_sys_Profiler_samples                                    7
+#define ES_ejs_sys_Profiler_stacks                                     8
+#define ES_ejs_sys_Profiler_reset                                      9
+#define ES_ejs_sys_Profiler_save                                       10
+#define ES_ejs_sys_Profiler_start                                      11
+#define ES_ejs_sys_Profiler_stop                                       12
+#define ES_ejs_sys_Profiler_NUM_CLASS_PROP                             13
+
+/**
+ * Instance slots for "Profiler" type 
+ */
+#define ES_ejs_sys_Profiler_NUM_INSTANCE_PROP                          0
+
+/**
+ * 
+ *    Local slots for methods in type Profiler 
+ */
+#define ES_ejs_sys_Profiler_save_path                                  0
+#define ES_ejs_sys_Profiler_start_interval                             0
+
+
 /**
  *   Class property slots for the "System" class 
  */
@@ -274,9 +301,9 @@
 #define ES_ejs_sys_Worker_preload_path                                 0
 #define ES_ejs_sys_Worker_lookup_name                                  0
 #define ES_ejs_sys_Worker_postMessage_data                             0
-#define ES_ejs_sys_Worker_postMessage_ports                            1
+#define ES_ejs_sys_Worker_postMessage_transfer                         1
 #define ES_ejs_sys_Worker_waitForMessage_timeout                       0
 
-#define _ES_CHECKSUM_ejs_sys 139985
+#define _ES_CHECKSUM_ejs_sys 148487
 
 #endif
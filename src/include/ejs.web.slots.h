@@ -582,11 +582,11 @@
 #define ES_ejs_web_View_ejs_web_getValue_fmt                           5
 #define ES_ejs_web_View_ejs_web_getValue__hoisted_6_part               6
 #define ES_ejs_web_View_ejs_web_date_fmt                               0
-#define ES_ejs_web_View_ejs_web_date___fun_5461__                      1
+#define ES_ejs_web_View_ejs_web_date___fun_5465__                      1
 #define ES_ejs_web_View_ejs_web_currency_fmt                           0
-#define ES_ejs_web_View_ejs_web_currency___fun_5495__                  1
+#define ES_ejs_web_View_ejs_web_currency___fun_5499__                  1
 #define ES_ejs_web_View_ejs_web_number_fmt                             0
-#define ES_ejs_web_View_ejs_web_number___fun_5525__                    1
+#define ES_ejs_web_View_ejs_web_number___fun_5529__                    1
 #define ES_ejs_web_View_ejs_web_getOptions_options                     0
 #define ES_ejs_web_View_ejs_web_getOptions_result                      1
 #define ES_ejs_web_View_ejs_web_getOptions__hoisted_2_option           2
@@ -1083,6 +1083,6 @@
 #define ES_ejs_web_GoogleConnector_getOptions__hoisted_3_word          3
 #define ES_ejs_web_GoogleConnector_write_str                           0
 
-#define _ES_CHECKSUM_ejs_web 459789
+#define _ES_CHECKSUM_ejs_web 459811
 
 #endif
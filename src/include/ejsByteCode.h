@@ -212,6 +212,21 @@ typedef enum EjsOpCode {
     EJS_OP_XOR,
     EJS_OP_CALL_FINALLY,
     EJS_OP_GOTO_FINALLY,
+    EJS_OP_ADD_NUM,
+    EJS_OP_SUB_NUM,
+    EJS_OP_MUL_NUM,
+    EJS_OP_DIV_NUM,
+    EJS_OP_INC_NUM,
+    EJS_OP_COMPARE_EQ_NUM,
+    EJS_OP_COMPARE_NE_NUM,
+    EJS_OP_COMPARE_LT_NUM,
+    EJS_OP_COMPARE_LE_NUM,
+    EJS_OP_COMPARE_GT_NUM,
+    EJS_OP_COMPARE_GE_NUM,
+    EJS_OP_INC_LOCAL_SLOT,
+    EJS_OP_ADD_LOCAL_SLOT,
+    EJS_OP_CALL_OUTER_NAME,
+    EJS_OP_GET_OUTER_NAME,
 } EjsOpCode;
 
 #endif
@@ -248,11 +248,37 @@ EjsOptable ejsOptable[] = {
     {   "XOR",                      -1,         { EBC_NONE,                               },},
     {   "CALL_FINALLY",              0,         { EBC_NONE,                               },},
     {   "GOTO_FINALLY",              0,         { EBC_NONE,                               },},
+    /*
+     *  Number specialized opcodes. The compiler emits these when both operands are declared numbers. The VM also
+     *  rewrites code to use them.
+     */
+    {   "ADD_NUM",                  -1,         { EBC_NONE,                               },},
+    {   "SUB_NUM",                  -1,         { EBC_NONE,                               },},
+    {   "MUL_NUM",                  -1,         { EBC_NONE,                               },},
+    {   "DIV_NUM",                  -1,         { EBC_NONE,                               },},
+    {   "INC_NUM",                   0,         { EBC_BYTE,                               },},
+    {   "COMPARE_EQ_NUM",           -1,         { EBC_NONE,                               },},
+    {   "COMPARE_NE_NUM",           -1,         { EBC_NONE,                               },},
+    {   "COMPARE_LT_NUM",           -1,         { EBC_NONE,                               },},
+    {   "COMPARE_LE_NUM",           -1,         { EBC_NONE,                               },},
+    {   "COMPARE_GT_NUM",           -1,         { EBC_NONE,                               },},
+    {   "COMPARE_GE_NUM",           -1,         { EBC_NONE,                               },},
+    /*
+     *  Superinstructions. The VM substitutes these for the first instruction of a common sequence when code is first
+     *  run. The rest of the sequence is left in place and supplies the operands.
+     */
+    {   "INC_LOCAL_SLOT",            0,         { EBC_NONE,                               },},
+    {   "ADD_LOCAL_SLOT",            0,         { EBC_NONE,                               },},
+    {   "CALL_OUTER_NAME",           0,         { EBC_STRING, EBC_STRING, EBC_NUM, EBC_ARGC,},},
+    {   "GET_OUTER_NAME",            1,         { EBC_STRING, EBC_STRING, EBC_NUM,        },},
     {   NULL,                        0,         { EBC_NONE,                               },},
 };
 #endif /* EJS_DEFINE_OPTABLE */
 
 extern EjsOptable *ejsGetOptable(MprCtx ctx);
+extern int ejsGetOpcodeCount(EjsOptable *optable);
+extern uchar *ejsGetNextInstruction(EjsOptable *optable, int maxOp, uchar *pc);
+extern int ejsGetNumberOpcode(int opcode);
 
 #ifdef __cplusplus
 }
@@ -176,6 +176,7 @@ typedef BLD_FEATURE_NUM_TYPE MprNumber;
  */
 #define EJS_FLAGS_ENUM_INHERITED 0x1            /**< Enumerate inherited base classes */
 #define EJS_FLAGS_ENUM_ALL      0x2             /**< Enumerate non-enumerable and fixture properties */
+#define EJS_FLAGS_PRETTY        0x4             /**< Serialize with newlines and indentation */
 
 /*
  *  Exception flags and structure
@@ -328,26 +329,31 @@ typedef struct EjsVar {
 #endif
     struct EjsType  *type;              /**< Type of this object (not base type). ie. type for Object is EjsType  */
 
+    uint    builder           :  1;     /**< String is owned by one local variable and may be appended in place */
     uint    builtin           :  1;     /**< Variable is part of the core and is always present */
     uint    dynamic           :  1;     /**< Object may add properties. Derrived from type */
     uint    hasGetterSetter   :  1;     /**< Class has getter/setter functions */
-    uint    hasNativeBase     :  1;     /**< Variable has a non-object based native base class */
 
+    uint    hasNativeBase     :  1;     /**< Variable has a non-object based native base class */
     uint    hidden            :  1;     /**< Not enumerable via for/in */
     uint    isFunction        :  1;     /**< Instance is a function */
     uint    isObject          :  1;     /**< Instance is an Object */
-    uint    isInstanceBlock   :  1;     /**< Object is a type instance block object */
 
+    uint    isInstanceBlock   :  1;     /**< Object is a type instance block object */
     uint    isType            :  1;     /**< Instance is a type object */
     uint    jsonVisited       :  1;     /**< JSON traversal */
+    uint    loaded            :  1;     /**< Builder string has been read since it was last appended */
+
     uint    marked            :  1;     /**< GC marked in use */
     uint    master            :  1;     /**< Allocated in the master interpreter */
 
     uint    native            :  1;     /**< Native property backed by C/Java implementation */
     uint    noPool            :  1;     /**< Object has private allocations and can't be pooled */
+    uint    old               :  1;     /**< Object has been promoted out of the new generation */
     uint    permanent         :  1;     /**< Object is immune from GC */
     uint    primitive         :  1;     /**< Variable is primitive and has no properties of any kind */
 
+    uint    remembered        :  1;     /**< Old object is in the GC remembered set */
     uint    separateSlots     :  1;     /**< Has a separate memory allocation for slots */
     uint    survived          :  1;     /**< Object has survived one GC pass */
     uint    visited           :  1;     /**< Has been traversed */
@@ -397,7 +403,6 @@ typedef EjsVar EjsObj;
  *  @ingroup EjsVar
  */
 extern EjsVar *ejsAllocVar(Ejs *ejs, struct EjsType *type, int size);
-extern EjsVar *ejsAllocPooledVar(Ejs *ejs, int id);
 
 /**
  *  Free a new variable
@@ -405,7 +410,7 @@ extern EjsVar *ejsAllocPooledVar(Ejs *ejs, int id);
  *      a variable is no longer needed. It should not be called by normal code.
  *  @param ejs Interpreter instance returned from #ejsCreate
  *  @param vp Variable to free
- *  @param pool Optional pool id. Set to -1 for defaults.
+ *  @param pool Optional type id for allocation statistics. Set to -1 for defaults.
  *  @ingroup EjsVar
  */
 extern void ejsFreeVar(Ejs *ejs, EjsVar *vp, int pool);
@@ -664,12 +669,24 @@ extern int ejsSetPropertyTrait(Ejs *ejs, EjsVar *vp, int slotNum, struct EjsType
  *  @description Serialize a variable into a JSON string representation
  *  @param ejs Interpreter instance returned from #ejsCreate
  *  @param value Value to serialize
- *  @param maxDepth Max depth of nesting in the object to serialize
- *  @param showAll Show non-enumerable properties
- *  @param showBase Show properties from base classes
+ *  @param maxDepth Max depth of nesting in the object to serialize. Set to zero or less for infinite depth.
+ *  @param flags Set to EJS_FLAGS_ENUM_ALL to show non-enumerable properties, EJS_FLAGS_ENUM_INHERITED to show 
+ *      properties from base classes and EJS_FLAGS_PRETTY to emit newlines and indentation. Otherwise the output 
+ *      is compact.
  *  @ingroup EjsVar
  */
-extern EjsVar *ejsSerialize(Ejs *ejs, EjsVar *value, int maxDepth, bool showAll, bool showBase);
+extern EjsVar *ejsSerialize(Ejs *ejs, EjsVar *value, int maxDepth, int flags);
+
+/**
+ *  Serialize the properties of an object into JSON
+ *  @description Serialize the properties of an object ignoring any toJSON method defined by its type.
+ *  @param ejs Interpreter instance returned from #ejsCreate
+ *  @param value Object to serialize
+ *  @param maxDepth Max depth of nesting in the object to serialize. Set to zero or less for infinite depth.
+ *  @param flags Serialization flags. See #ejsSerialize.
+ *  @ingroup EjsVar
+ */
+extern EjsVar *ejsSerializeObject(Ejs *ejs, EjsVar *value, int maxDepth, int flags);
 
 /**
  *  Deserialize a JSON string
@@ -717,9 +734,29 @@ typedef struct EjsNames {
     int             *buckets;               /**< Hash buckets and head of link chains */
     int             sizeBuckets;            /**< Size of buckets */
     int             sizeEntries;            /**< Size of entries array in elements */
+    int             shared;                 /**< Names are an immutable shape shared by many objects */
 } EjsNames;
 
 
+/**
+ *  Object Shape
+ *  @description Dynamic objects that add the same properties in the same order share one immutable set of property 
+ *      names called a shape. Adding a property moves the object to a child shape. Shapes form a tree rooted at 
+ *      the empty shape and live until the interpreter is destroyed.
+ *  @ingroup EjsObject
+ */
+typedef struct EjsShape {
+    EjsNames        names;                  /**< Shared property names. Must be first */
+    struct Ejs      *ejs;                   /**< Interpreter owning the shape tree */
+    struct EjsShape *children;              /**< Shapes with one more property */
+    struct EjsShape *next;                  /**< Next sibling transition from the parent shape */
+    int             numProp;                /**< Number of named properties */
+    int             numChildren;            /**< Number of child shapes */
+    int             generation;             /**< Global name generation captured by a snapshot */
+    int             refs;                   /**< Cloned interpreters created with a snapshot */
+} EjsShape;
+
+
 /**
  *  Object Type. Base type for all objects.
  *  @description The EjsObject type is used as the foundation for types, blocks, functions and all scripted classes. 
@@ -827,6 +864,7 @@ extern void     ejsMarkObject(Ejs *ejs, EjsVar *parent, EjsObject *obj);
 extern int      ejsCheckObjSlot(Ejs *ejs, EjsObject *obj, int slotNum);
 extern EjsVar   *ejsCoerceOperands(Ejs *ejs, EjsVar *lhs, int opcode, EjsVar *rhs);
 extern int      ejsComputeHashCode(struct EjsNames *hash, EjsName *qname);
+extern EjsShape *ejsCreateSnapshotShape(Ejs *ejs, EjsObject *obj);
 extern int      ejsGetHashSize(int numProp);
 extern void     ejsInitializeObjectHelpers(struct EjsTypeHelpers *helpers);
 extern int      ejsInsertGrowObject(Ejs *ejs, EjsObject *obj, int size, int offset);
@@ -838,8 +876,10 @@ extern EjsVar   *ejsObjectOperator(Ejs *ejs, EjsVar *lhs, int opcode, EjsVar *rh
 extern int      ejsRebuildHash(Ejs *ejs, EjsObject *obj);
 extern void     ejsResetHash(Ejs *ejs, EjsObject *obj);
 extern void     ejsRemoveSlot(Ejs *ejs, EjsObject *slots, int slotNum, int compact);
+extern int      ejsReserveObjectSlots(Ejs *ejs, EjsObject *obj, int count);
 extern void     ejsSerializeHelper(Ejs *ejs, int argc, EjsVar **argv, int *maxDepth, int *flags);
 extern void     ejsSetAllocIncrement(Ejs *ejs, struct EjsType *type, int increment);
+extern int      ejsSetPropertyByAllocatedName(Ejs *ejs, EjsObject *obj, char *space, char *name, EjsVar *value);
 extern EjsVar   *ejsToSource(Ejs *ejs, EjsVar *vp, int argc, EjsVar **argv);
 
 
@@ -1182,6 +1222,8 @@ typedef struct EjsCode {
     int             numHandlers;            /**< Number of exception handlers */
     int             sizeHandlers;           /**< Size of handlers array */
     struct EjsEx    **handlers;             /**< Exception handlers */
+    int             heat;                   /**< Calls and backward branches taken. See EJS_FLAG_JIT */
+    int             quickened;              /**< Superinstructions have been substituted */
 } EjsCode;
 
 
@@ -1270,7 +1312,7 @@ typedef struct EjsFunction {
 #else
     #define ejsIsFunction(vp)       ejsIs(vp, ES_Function)
     #define ejsIsNativeFunction(vp) (ejsIsFunction(vp) && (((EjsFunction*) (vp))->nativeProc))
-    #define ejsIsInitializer(vp)    (ejsIsFunction(vp) && (((EjsFunction*) (vp))->isInitializer)
+    #define ejsIsInitializer(vp)    (ejsIsFunction(vp) && (((EjsFunction*) (vp))->isInitializer))
 #endif
 
 /**
@@ -1355,9 +1397,48 @@ typedef struct EjsFrame {
     cchar           *filename;              /**< Source code file name */
     int             lineNumber;             /**< Source code line number */
     uint            argc;                   /**< Actual parameter count */
+    char            *frames;                /**< Frame stack top to restore when the frame returns */
 } EjsFrame;
 
 extern EjsFrame *ejsCreateFrame(Ejs *ejs, EjsFunction *src);
+
+/**
+ *  Push a function activation frame
+ *  @description Frames are carved from the interpreter frame stack and released in LIFO order by ejsPopFrame. 
+ *      If the frame stack is exhausted, the frame is allocated from the heap instead. A frame on the frame stack
+ *      must be promoted via ejsPromoteFrame before it can be captured by a closure or any other long lived object.
+ *  @param ejs Interpreter instance returned from #ejsCreate
+ *  @param src Function to create a frame for
+ *  @return The new frame
+ *  @ingroup EjsFunction
+ */
+extern EjsFrame *ejsPushFrame(Ejs *ejs, EjsFunction *src);
+
+/**
+ *  Pop a function activation frame
+ *  @description Release a frame allocated by ejsPushFrame and any frames above it on the frame stack.
+ *  @param ejs Interpreter instance returned from #ejsCreate
+ *  @param frame Frame to release
+ *  @ingroup EjsFunction
+ */
+extern void ejsPopFrame(Ejs *ejs, EjsFrame *frame);
+
+/**
+ *  Promote a frame to the heap
+ *  @description Copy a frame from the frame stack to the heap so it can outlive the function call. The interpreter
+ *      state and any scope blocks referring to the frame are updated to refer to the heap copy.
+ *  @param ejs Interpreter instance returned from #ejsCreate
+ *  @param frame Current frame
+ *  @return The heap frame. If the frame is already on the heap, it is returned unchanged.
+ *  @ingroup EjsFunction
+ */
+extern EjsFrame *ejsPromoteFrame(Ejs *ejs, EjsFrame *frame);
+
+/*
+ *  Test if a block is a frame on the frame stack. These are not managed by the garbage collector.
+ */
+#define ejsIsStackFrame(ejs, bp) \
+    ((char*) (bp) >= (ejs)->state->framesBase && (char*) (bp) < (ejs)->state->framesEnd)
 extern EjsBlock *ejsPopBlock(Ejs *ejs);
 extern EjsBlock *ejsPushBlock(Ejs *ejs, EjsBlock *block);
 
@@ -1555,6 +1636,44 @@ extern int ejsCopyToByteArray(Ejs *ejs, EjsByteArray *ap, int offset, char *data
 
 extern struct EjsNumber *ejsWriteToByteArray(Ejs *ejs, EjsByteArray *ap, int argc, EjsVar **argv);
 
+/**
+ *  Encode a value using the structured clone format
+ *  @description The structured clone format is a compact binary encoding used to copy values between interpreters.
+ *      Shared objects and cycles are preserved. Dates and byte arrays are copied by value. Other types that define
+ *      toJSON are encoded using their JSON representation.
+ *  @param ejs Ejs reference returned from #ejsCreate
+ *  @param ctx Memory context to own the encoding buffer
+ *  @param vp Value to encode
+ *  @param transfer Optional array of byte arrays to transfer. The buffers of these byte arrays are moved to the 
+ *      encoding without copying and the byte arrays are left empty. Set to NULL to copy all byte arrays.
+ *  @return A buffer containing the encoding. Returns null and throws an exception if the value can't be encoded.
+ *  @ingroup EjsByteArray
+ */
+extern MprBuf *ejsEncodeClone(Ejs *ejs, MprCtx ctx, EjsVar *vp, EjsArray *transfer);
+
+/**
+ *  Decode a value encoded by #ejsEncodeClone
+ *  @param ejs Ejs reference returned from #ejsCreate
+ *  @param data Encoded data
+ *  @param len Length of the encoded data
+ *  @param transfer Set to true to accept transferred byte array buffers. Only set this for encodings created by 
+ *      #ejsEncodeClone in this process that will not be decoded again.
+ *  @return The decoded value. Returns null and throws an exception if the data is corrupt.
+ *  @ingroup EjsByteArray
+ */
+extern EjsVar *ejsDecodeClone(Ejs *ejs, cchar *data, int len, bool transfer);
+
+/**
+ *  Encode a value into a new byte array
+ *  @description This encodes a value using #ejsEncodeClone into a byte array allocated by another interpreter.
+ *  @param ejs Ejs reference returned from #ejsCreate
+ *  @param owner Interpreter to own the byte array
+ *  @param vp Value to encode
+ *  @return A byte array holding the encoding between its read and write positions.
+ *  @ingroup EjsByteArray
+ */
+extern EjsByteArray *ejsCloneToByteArray(Ejs *ejs, Ejs *owner, EjsVar *vp);
+
 
 /**
  *  Date class
@@ -2166,6 +2285,7 @@ typedef struct EjsRegExp {
     EjsObject       var;                /**< NEW: Extends Object - Property storage */
     char            *pattern;           /**< Pattern to match with */
     void            *compiled;          /**< Compiled pattern */
+    struct EjsRegex *regex;             /**< Regular expression cache entry owning the compiled pattern */
     bool            global;             /**< Search for pattern globally (multiple times) */
     bool            ignoreCase;         /**< Do case insensitive matching */
     bool            multiline;          /**< Match patterns over multiple lines */
@@ -2198,6 +2318,7 @@ extern EjsRegExp *ejsCreateRegExp(Ejs *ejs, cchar *pattern);
 #endif
 
 extern EjsVar *ejsRegExpToString(Ejs *ejs, EjsRegExp *rp);
+extern void ejsPrintRegExpCacheReport(Ejs *ejs);
 
 /**
  *  String Class
@@ -2268,6 +2389,20 @@ extern EjsString *ejsCreateBareString(Ejs *ejs, int len);
  */
 extern EjsString *ejsCreateStringWithLength(Ejs *ejs, cchar *value, int len);
 
+/**
+ *  Concatenate two strings
+ *  @description Create a new string with the contents of two strings. If build is true, the result will be stored
+ *      only in a local variable and the lhs string may be appended in place if it is a builder owned by that
+ *      variable. Otherwise the result is a new builder string with room to grow.
+ *  @param ejs Ejs reference returned from #ejsCreate
+ *  @param lhs Left hand string
+ *  @param rhs Right hand string to append
+ *  @param build Set to true if the result replaces the lhs in the only variable referencing it
+ *  @return A string object
+ *  @ingroup EjsString
+ */
+extern EjsString *ejsConcatString(Ejs *ejs, EjsString *lhs, EjsString *rhs, int build);
+
 /**
  *  Duplicate a string object
  *  @param ejs Ejs reference returned from #ejsCreate
@@ -2307,6 +2442,28 @@ typedef struct EjsTimer {
 } EjsTimer;
 
 
+/**
+ *  Incremental JSON parser
+ *  @description Text is written to the parser in chunks. Each value at the emit depth is parsed once complete and 
+ *      passed to the callback so the whole document is never held in memory.
+ *  @ingroup EjsVar
+ */
+typedef struct EjsJSONParser {
+    EjsObject       obj;                /**< Extends Object */
+    EjsFunction     *callback;          /**< Function invoked with each completed value and its key */
+    MprBuf          *input;             /**< Unconsumed input text */
+    int             depth;              /**< Nesting depth of values to emit */
+    int             level;              /**< Number of open containers at the scan position */
+    int             scan;               /**< Offset in input of the next character to scan */
+    int             start;              /**< Offset in input of the pending value at the emit depth. -1 if none */
+    int             quote;              /**< Quote character while scanning a string */
+    int             escape;             /**< Next character is escaped */
+    int             isArray;            /**< Container holding the values at the emit depth is an array */
+    int             index;              /**< Index of the next array element at the emit depth */
+    int             busy;               /**< Scanning input or running the callback */
+} EjsJSONParser;
+
+
 #if BLD_FEATURE_MULTITHREAD
 
 #define EJS_WORKER_BEGIN        1                   /**< Worker yet to start */
@@ -2516,6 +2673,7 @@ extern void     ejsCreateNumberType(Ejs *ejs);
 extern void     ejsCreateNullType(Ejs *ejs);
 extern void     ejsCreateObjectType(Ejs *ejs);
 extern void     ejsCreatePathType(Ejs *ejs);
+extern void     ejsCreateProfilerType(Ejs *ejs);
 extern void     ejsCreateReflectType(Ejs *ejs);
 extern void     ejsCreateRegExpType(Ejs *ejs);
 extern void     ejsCreateStringType(Ejs *ejs);
@@ -2559,6 +2717,7 @@ extern void     ejsConfigureNumberType(Ejs *ejs);
 extern void     ejsConfigureNullType(Ejs *ejs);
 extern void     ejsConfigureObjectType(Ejs *ejs);
 extern void     ejsConfigurePathType(Ejs *ejs);
+extern void     ejsConfigureProfilerType(Ejs *ejs);
 extern void     ejsConfigureReflectType(Ejs *ejs);
 extern void     ejsConfigureRegExpType(Ejs *ejs);
 extern void     ejsConfigureStringType(Ejs *ejs);
@@ -134,6 +134,11 @@ extern "C" {
 #define EJS_FIXUP_LOCAL                 6
 #define EJS_FIXUP_EXCEPTION             7
 
+/*
+ *  Source text prefix of the debug instruction the compiler emits before the code of an inlined function
+ */
+#define EJS_INLINE_MARKER               "@inline "
+
 /*
  *  Number encoding uses one bit per byte plus a sign bit in the first byte
  */ 
@@ -154,7 +159,7 @@ typedef struct EjsTypeFixup
 /*
  *  Module file format version
  */
-#define EJS_MODULE_VERSION      2
+#define EJS_MODULE_VERSION      3
 #define EJS_VERSION_FACTOR      1000
 
 /*
@@ -230,6 +235,9 @@ typedef struct EjsConst {
     int         base;                       /* Base used during relocations */
     int         locked;                     /* No more additions allowed */
     MprHashTable *table;                    /* Hash table for fast lookup */
+    int         *atomTokens;                /* Pool offsets of interned strings. Open hash, -1 if unused */
+    cchar       **atoms;                    /* Interned strings corresponding to atomTokens */
+    int         atomMask;                   /* Size of the atom hash minus one */
 } EjsConst;
 
 
@@ -328,6 +336,7 @@ extern char         *ejsModuleReadString(struct Ejs *ejs, EjsModule *module);
 extern int          ejsModuleReadType(struct Ejs *ejs, EjsModule *module, EjsType **typeRef, EjsTypeFixup **fixup, 
                         EjsName *typeName, int *slotNum);
 extern int          ejsSetModuleConstants(struct Ejs *ejs, EjsModule *mp, cchar *pool, int poolSize);
+extern char         *ejsGetConstString(EjsConst *constants, int token);
 
 extern double       ejsDecodeDouble(Ejs *ejs, uchar **pp);
 extern int64        ejsDecodeNum(uchar **pp);
@@ -47,6 +47,10 @@ extern "C" {
     #define EJS_WEB_MAX_HEADER      1024
     #define EJS_MAX_DEBUG_NAME      32
     #define EJS_MAX_TYPE            256             /**< Maximum number of types */
+    #define EJS_INLINE_CACHE_SIZE   64              /**< Number of inline cache sites (power of 2) */
+    #define EJS_MAX_SHAPES          512             /**< Maximum number of shared object shapes */
+    #define EJS_REGEX_CACHE_SIZE    16              /**< Compiled regular expressions to cache (power of 2) */
+    #define EJS_JSON_BUF_SIZE       256             /**< Initial size of the JSON serialization buffer */
 
     #define EJS_CGI_MIN_BUF         (32 * 1024)     /* CGI output buffering */
     #define EJS_CGI_MAX_BUF         (128 * 1024)
@@ -77,6 +81,10 @@ extern "C" {
     #define EJS_WEB_MAX_HEADER      4096
     #define EJS_MAX_DEBUG_NAME      64
     #define EJS_MAX_TYPE            512
+    #define EJS_INLINE_CACHE_SIZE   256
+    #define EJS_MAX_SHAPES          2048
+    #define EJS_REGEX_CACHE_SIZE    64
+    #define EJS_JSON_BUF_SIZE       1024
 
     #define EJS_CGI_MIN_BUF         (64 * 1024)     /* CGI output buffering */
     #define EJS_CGI_MAX_BUF         (256 * 1024)
@@ -106,6 +114,10 @@ extern "C" {
     #define EJS_WEB_MAX_HEADER      4096
     #define EJS_MAX_DEBUG_NAME      96
     #define EJS_MAX_TYPE            1024
+    #define EJS_INLINE_CACHE_SIZE   1024
+    #define EJS_MAX_SHAPES          8192
+    #define EJS_REGEX_CACHE_SIZE    128
+    #define EJS_JSON_BUF_SIZE       4096
 
     #define EJS_CGI_MIN_BUF         (128 * 1024)     /* CGI output buffering */
     #define EJS_CGI_MAX_BUF         (512 * 1024)
@@ -116,7 +128,26 @@ extern "C" {
  *  Set cross gen root set size to the work quote * 120%. This ensures we don't often overflow a root set.
  */
 #define EJS_NUM_CROSS_GEN           (EJS_GC_WORK_QUOTA * 12 / 10) 
-#define EJS_MAX_TYPE_POOL           200             /* Number of objects to pool per type */
+#define EJS_GC_MAJOR_INTERVAL       8               /* Minor collections between major collections */
+#define EJS_SLAB_QUANTUM            16              /* Object size class granularity in bytes */
+#define EJS_NUM_SLABS               128             /* Object size classes. Larger objects are not pooled */
+#define EJS_MAX_SLAB_POOL           256             /* Number of free objects to pool per size class */
+#define EJS_MIN_CACHED_NUM          -128            /* Smallest integer with a preallocated Number value */
+#define EJS_MAX_CACHED_NUM          1023            /* Largest integer with a preallocated Number value */
+#define EJS_MAX_ATOM_LEN            64              /* Longest constant pool string to intern */
+#define EJS_JSON_MAX_ERROR_TEXT     256             /* Input text to show in JSON parse errors */
+#define EJS_MAX_CLONE_DEPTH         1024            /* Deepest nesting of decoded clone data */
+#define EJS_MIN_BUILDER_STRING      256             /* Shortest concatenation given room to be appended in place */
+#define EJS_SORT_MIN_RUN            32              /* Runs shorter than this are extended by insertion sort */
+#define EJS_ATOM_HASH_SIZE          1024            /* Initial size of the interned names hash (power of 2) */
+#define EJS_CACHE_WAYS              4               /* Receiver shapes per inline cache site before megamorphic */
+#define EJS_MAX_SHAPE_PROP          64              /* Objects with more properties use private names */
+#define EJS_MAX_SHAPE_CHILDREN      32              /* Maximum transitions from one shape */
+#define EJS_JIT_THRESHOLD           1000            /* Calls or loop iterations before a function is translated */
+#define EJS_PROFILE_INTERVAL        1000            /* Calls and branches between profiler samples */
+#define EJS_PROFILE_MAX_DEPTH       64              /* Deepest call stack recorded by the profiler */
+#define EJS_OPSTATS_SAMPLE          64              /* Instructions between timed instructions with OPSTATS */
+#define EJS_OPSTATS_PAIRS           100             /* Opcode pairs to list in the OPSTATS report */
 
 #define EJS_SQLITE_TIMEOUT          30000           /* Database busy timeout */
 #define EJS_SESSION_TIMEOUT         1800
@@ -150,6 +181,28 @@ extern "C" {
     #endif
 #endif
 
+/*
+ *  Function activation frames are carved from a per-interpreter frame stack. Calls nested deeper than this fall
+ *  back to allocating frames from the heap.
+ */
+#if BLD_FEATURE_MMU
+    #if BLD_TUNE == MPR_TUNE_SIZE
+        #define EJS_FRAME_STACK_MAX (1024 * 256)    /* Frame stack size on virtual memory systems */
+    #elif BLD_TUNE == MPR_TUNE_BALANCED
+        #define EJS_FRAME_STACK_MAX (1024 * 1024)
+    #else
+        #define EJS_FRAME_STACK_MAX (1024 * 1024 * 4)
+    #endif
+#else
+    #if BLD_TUNE == MPR_TUNE_SIZE
+        #define EJS_FRAME_STACK_MAX (1024 * 64)     /* Frame stack size without MMU */
+    #elif BLD_TUNE == MPR_TUNE_BALANCED
+        #define EJS_FRAME_STACK_MAX (1024 * 128)
+    #else
+        #define EJS_FRAME_STACK_MAX (1024 * 256)
+    #endif
+#endif
+
 /*
  *  Sanity constants. Only for sanity checking. Set large enough to never be a
  *  real limit but low enough to catch some errors in development.
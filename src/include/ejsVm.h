@@ -55,6 +55,7 @@ struct EjsWorker;
 #define EJS_FLAG_DOC            0x40        /**< Load documentation from modules */
 #define EJS_FLAG_EXIT           0x80        /**< Interpreter should exit */
 #define EJS_FLAG_NOEXIT         0x200       /**< App should service events and not exit */
+#define EJS_FLAG_JIT            0x800       /**< Translate hot functions to specialized byte code */
 
 #define EJS_FLAG_DYNAMIC        0x400       /* Make a type that is dynamic itself */
 #define EJS_STACK_ARG           -1          /* Offset to locate first arg */
@@ -100,6 +101,19 @@ extern EjsName *ejsAllocName(MprCtx ctx, cchar *space, cchar *name);
 extern EjsName *ejsDupName(MprCtx ctx, EjsName *qname);
 extern EjsName ejsCopyName(MprCtx ctx, EjsName *qname);
 
+/**
+ *  Intern a name string
+ *  @description Return the unique interpreter-wide copy of a name or namespace string. Names interned via this
+ *      routine may be compared by pointer. Property lookup falls back to string comparison for names that are not
+ *      interned, so interning is an optimization and never required for correctness.
+ *  @param ejs Ejs reference returned from #ejsCreate
+ *  @param str String to intern
+ *  @return The interned string. This is owned by the interpreter and must not be modified or freed.
+ *  @ingroup EjsName
+ */
+extern cchar *ejsInternString(struct Ejs *ejs, cchar *str);
+extern cchar *ejsInternConstant(struct Ejs *ejs, cchar *str);
+
 /**
  *  VM Evaluation state. 
  *  The VM Stacks grow forward in memory. A push is done by incrementing first, then storing. ie. *++top = value
@@ -113,6 +127,9 @@ typedef struct EjsState {
     struct EjsVar       **stackBase;        /* Pointer to start of stack mem */
     struct EjsVar       **stackEnd;         /* Only used on non-virtual memory systems */
     int                 stackSize;          /* Stack size */
+    char                *frames;            /* Top of the frame stack. Next frame is carved from here */
+    char                *framesBase;        /* Start of frame stack memory */
+    char                *framesEnd;         /* End of frame stack memory */
 } EjsState;
 
 
@@ -152,8 +169,9 @@ typedef struct EjsLookup {
  *  GC Object generations
  */
 #define EJS_GEN_NEW         0           /* New objects */
-#define EJS_GEN_ETERNAL     1           /* Builtin objects that live forever */
-#define EJS_MAX_GEN         2           /* Number of generations for object allocation */
+#define EJS_GEN_OLD         1           /* Objects promoted after surviving two collections */
+#define EJS_GEN_ETERNAL     2           /* Builtin objects that live forever */
+#define EJS_MAX_GEN         3           /* Number of generations for object allocation */
 
 /*
  *  GC Collection modes
@@ -171,18 +189,29 @@ typedef struct EjsGen
 
 
 /*
- *  GC Pool of free objects of a given type. Each type maintains a free pool for faster allocations.
- *  Types in the pool have a weak reference and may be reclaimed.
+ *  GC allocation statistics for a given type
  */
 typedef struct EjsPool
 {
-    struct EjsType  *type;              /* Owning type */
     int             allocated;          /* Count of instances created */
     int             peakAllocated;      /* High water mark for allocated */
-    int             count;              /* Count in pool */
+} EjsPool;
+
+
+/*
+ *  GC slab of free objects of a given size class. Objects are allocated in multiples of EJS_SLAB_QUANTUM bytes and 
+ *  freed objects of any type are kept on the free list of their size class for faster allocations. Free objects are 
+ *  the children of the slab and may be reclaimed.
+ */
+typedef struct EjsSlab
+{
+    int             size;               /* Object size for this class (excluding the MprBlk header) */
+    int             count;              /* Count of free objects */
     int             peakCount;          /* High water mark for count */
     int             reuse;              /* Count of reuses */
-} EjsPool;
+} EjsSlab;
+
+#define EJS_SLAB_SIZE(size) (((size) + EJS_SLAB_QUANTUM - 1) & ~(EJS_SLAB_QUANTUM - 1))
 
 
 /*
@@ -191,8 +220,9 @@ typedef struct EjsPool
 typedef struct EjsGC {
 
     EjsGen      *generations[EJS_MAX_GEN];
-    EjsPool     *pools[EJS_MAX_TYPE];   /* Object pools */
+    EjsPool     *pools[EJS_MAX_TYPE];   /* Per type allocation statistics */
     int         numPools;               /* Count of object pools */
+    EjsSlab     *slabs[EJS_NUM_SLABS];  /* Size class free lists */
     uint        allocGeneration;        /* Current generation accepting objects */
     uint        collectGeneration;      /* Current generation doing GC */
     uint        markGenRef;             /* Generation to mark objects */
@@ -210,6 +240,15 @@ typedef struct EjsGC {
     uint        totalOverflows;         /* Total overflows  */
     uint        totalRedlines;          /* Total times redline limit exceeded */
     uint        totalSweeps;            /* Total sweeps */
+    uint        totalMinor;             /* Total minor (new generation only) collections */
+    uint        totalMajor;             /* Total major collections */
+    uint        totalPromoted;          /* Total objects promoted to the old generation */
+    struct EjsVar **remembered;         /* Remembered set. Old objects that may reference new objects */
+    int         numRemembered;          /* Count of objects in the remembered set */
+    int         sizeRemembered;         /* Size of the remembered vector */
+    int         minorCount;             /* Minor collections since the last major collection */
+    bool        tenureEternal;          /* Eternal objects allocated since the last collection need tenuring */
+    bool        rebuildRemembered;      /* Remembered set overflowed and must be rebuilt by a major collection */
 #if BLD_DEBUG
     int         indent;                 /* Indent formatting in GC reports */
 #endif
@@ -231,6 +270,18 @@ extern void     ejsPrintAllocReport(struct Ejs *ejs);
 extern void     ejsMakeEternalPermanent(struct Ejs *ejs);
 extern void     ejsMakePermanent(struct Ejs *ejs, struct EjsVar *vp);
 extern void     ejsMakeTransient(struct Ejs *ejs, struct EjsVar *vp);
+extern void     ejsRememberVar(struct Ejs *ejs, struct EjsVar *obj, struct EjsVar *value);
+
+/*
+ *  Write barrier. Must be used when storing a reference into the slots of an object. Minor collections do not rescan 
+ *  old objects, so an old object updated to reference a new object must be added to the remembered set.
+ */
+#define ejsWriteBarrier(ejs, obj, value) \
+    do { \
+        if (unlikely(((EjsVar*) (obj))->old) && !((EjsVar*) (obj))->remembered && (value)) { \
+            ejsRememberVar(ejs, (EjsVar*) (obj), (EjsVar*) (value)); \
+        } \
+    } while (0)
 
 #if BLD_DEBUG
 extern void     ejsAddToGcStats(struct Ejs *ejs, struct EjsVar *vp, int id);
@@ -238,6 +289,88 @@ extern void     ejsAddToGcStats(struct Ejs *ejs, struct EjsVar *vp, int id);
 #define ejsAddToGcStats(ejs, vp, id)
 #endif
 
+/*
+ *  Interned name strings. This is an open hash of unique strings. The strings reside in module constant pools or
+ *  are allocated by ejsInternString.
+ */
+typedef struct EjsAtoms {
+    cchar       **strings;          /**< Hash of interned strings. Null entries are unused */
+    int         size;               /**< Size of strings. Always a power of 2 */
+    int         count;              /**< Number of interned strings */
+} EjsAtoms;
+
+/*
+ *  Inline cache entry. Records where a property was found for a given receiver shape.
+ */
+typedef struct EjsCacheEntry {
+    struct EjsType  *type;          /**< Receiver type */
+    struct EjsNames *names;         /**< Receiver names table (object receivers only) */
+    struct EjsVar   *owner;         /**< Base type owning the property. Null if owned by the receiver */
+    cchar           *space;         /**< Namespace of the property that was found */
+    int             slotNum;        /**< Property slot in the owner */
+    int             nthBase;        /**< Property on Nth super type -- count from the object */
+} EjsCacheEntry;
+
+/*
+ *  Inline cache for one GET/PUT/CALL_OBJ_NAME instruction. Sites are direct mapped by byte code address.
+ */
+typedef struct EjsCacheSite {
+    uchar           *pc;            /**< Address of the instruction owning the site. Null if unused */
+    cchar           *name;          /**< Property name referenced by the instruction */
+    cchar           *space;         /**< Property namespace referenced by the instruction */
+    uint            epoch;          /**< Cache epoch when the entries were recorded */
+    int             numEntries;     /**< Count of valid entries */
+    int             megamorphic;    /**< Too many receiver shapes seen. Don't cache */
+    uint            hits;           /**< Count of cache hits */
+    uint            misses;         /**< Count of cache misses */
+    char            function[EJS_MAX_DEBUG_NAME];   /**< Name of the function containing the instruction */
+    EjsCacheEntry   entries[EJS_CACHE_WAYS];
+} EjsCacheSite;
+
+typedef struct EjsInlineCache {
+    EjsCacheSite    *sites;         /**< Cache sites */
+    int             size;           /**< Number of sites. Always a power of 2 */
+    uint            epoch;          /**< Incremented to invalidate all cache entries */
+    uint            hits;           /**< Total cache hits */
+    uint            misses;         /**< Total cache misses */
+    uint            megamorphic;    /**< Total lookups at megamorphic sites */
+    uint            evictions;      /**< Sites reassigned to another instruction */
+} EjsInlineCache;
+
+extern void     ejsResetInlineCache(struct Ejs *ejs);
+extern void     ejsPrintInlineCacheReport(struct Ejs *ejs);
+
+/*
+ *  Sampling profiler. The VM samples the call stack every "interval" calls and branches and counts samples by 
+ *  call stack. See ejsProfiler.c.
+ */
+typedef struct EjsProfiler {
+    MprHashTable    *stacks;        /**< Sample counts keyed by collapsed call stack */
+    int             interval;       /**< Calls and branches between samples */
+    int             countdown;      /**< Calls and branches until the next sample */
+    int             samples;        /**< Count of samples taken */
+    int             running;        /**< Profiler is taking samples */
+} EjsProfiler;
+
+extern int      ejsStartProfiler(struct Ejs *ejs, int interval);
+extern void     ejsStopProfiler(struct Ejs *ejs);
+extern void     ejsResetProfiler(struct Ejs *ejs);
+extern void     ejsSampleProfiler(struct Ejs *ejs);
+extern char     *ejsGetProfile(struct Ejs *ejs);
+extern int      ejsWriteProfile(struct Ejs *ejs, cchar *path, bool append);
+
+/*
+ *  Opcode execution statistics. Shared by all interpreters of a service. See ejsInterp.c.
+ */
+typedef struct EjsOpStats {
+    uint64          counts[256];        /**< Executions of each opcode */
+    uint64          cycles[256];        /**< CPU cycles in timed executions of each opcode */
+    uint64          timed[256];         /**< Count of timed executions of each opcode */
+    uint64          pairs[256][256];    /**< Executions of each opcode followed by another opcode */
+} EjsOpStats;
+
+extern void     ejsPrintOpStats(struct Ejs *ejs);
+
 typedef struct EjsLoadState {
     MprList     *typeFixups;        /**< Loaded types to fixup */
     MprList     *modules;           /**< Modules being loaded */
@@ -307,6 +440,7 @@ typedef struct Ejs {
     struct EjsNumber    *minValue;          /**< Minimum number value */
     struct EjsNumber    *minusOneValue;     /**< The -1 number value */
     struct EjsNumber    *nanValue;          /**< The "NaN" value if floating point numbers, else zero */
+    struct EjsNumber    **numberCache;      /**< Preallocated small integer values (EJS_MIN_CACHED_NUM..MAX) */
     struct EjsNumber    *negativeInfinityValue; /**< The negative infinity number value */
     struct EjsVar       *nullValue;         /**< The "null" value */
     struct EjsNumber    *oneValue;          /**< The 1 number value */
@@ -332,7 +466,6 @@ typedef struct Ejs {
     int                 dontExit;           /**< Prevent App.exit() exiting the app */
     int                 flags;              /**< Execution flags */
     int                 exitStatus;         /**< Status to exit() */
-    int                 serializeDepth;     /**< Serialization depth */
     int                 joining;            /**< In Worker.join */
 
     int                 workQuota;          /* Quota of work before GC */
@@ -364,9 +497,24 @@ typedef struct Ejs {
 
     MprHashTable        *coreTypes;         /**< Core type instances */
     MprHashTable        *standardSpaces;    /**< Hash of standard namespaces (global namespaces) */
+    EjsAtoms            atoms;              /**< Interned name and namespace strings */
+    EjsInlineCache      *inlineCache;       /**< Property lookup inline caches */
+    struct EjsRegexCache *regexCache;       /**< Compiled regular expressions */
+    EjsProfiler         *profiler;          /**< Sampling profiler. Null until first started */
+    struct EjsShape     *shapes;            /**< Root of the shared object shape tree */
+    int                 numShapes;          /**< Number of object shapes created */
+    struct EjsShape     *globalShape;       /**< Snapshot of the global names shared with cloned interpreters.
+                                                 For a clone, the snapshot it was created with */
+    int                 globalGeneration;   /**< Incremented when the global property names change */
     MprHashTable        *doc;               /**< Documentation */
     void                *sqlite;            /**< Sqlite context information */
 
+#if BLD_FEATURE_EJS_OPSTATS
+    uint64              timedStart;         /**< Cycle count when the timed opcode was dispatched */
+    int                 timedOp;            /**< Opcode being timed. Set to -1 if none */
+    int                 lastOp;             /**< Last opcode dispatched. Set to -1 if none */
+    int                 opCountdown;        /**< Instructions since the last timed opcode */
+#endif
 #if BLD_FEATURE_MULTITHREAD
     MprMutex            *mutex;             /**< Multithread synchronization */
 #endif
@@ -383,6 +531,9 @@ typedef struct EjsService {
     MprHashTable        *nativeModules;     /**< Native module initialization callbacks */
     struct EjsVar       *(*loadScriptLiteral)(struct Ejs *ejs, cchar *script);
     struct EjsVar       *(*loadScriptFile)(struct Ejs *ejs, cchar *path);
+#if BLD_FEATURE_EJS_OPSTATS
+    EjsOpStats          *opStats;           /**< Opcode execution statistics */
+#endif
 } EjsService;
 
 #define ejsGetAllocCtx(ejs) ejs->currentGeneration
@@ -539,6 +690,7 @@ extern int ejsLookupVar(Ejs *ejs, struct EjsVar *vp, EjsName *name, EjsLookup *l
 extern int ejsLookupVarWithNamespaces(Ejs *ejs, struct EjsVar *vp, EjsName *name, EjsLookup *lookup);
 extern struct EjsModule *ejsLookupModule(Ejs *ejs, cchar *name, int minVersion, int maxVersion);
 extern int ejsLookupScope(Ejs *ejs, EjsName *name, EjsLookup *lookup);
+extern int ejsLookupOuterScope(Ejs *ejs, EjsName *name, int depth, EjsLookup *lookup);
 extern void ejsMemoryFailure(MprCtx ctx, int64 size, int64 total, bool granted);
 extern int ejsRemoveModule(Ejs *ejs, struct EjsModule *up);
 extern int ejsRunProgram(Ejs *ejs, cchar *className, cchar *methodName);
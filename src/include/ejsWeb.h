@@ -58,11 +58,15 @@ typedef struct EjsWebControl {
     cchar       *serverRoot;                /* Web serverRoot path */
     cchar       *searchPath;                /* Module search path */
     int         nextSession;                /* Session ID counter */
+    MprHashTable *pools;                    /* Pools of warm interpreters keyed by application */
+    cchar       *profilePath;               /* File to append request profiles. Null disables profiling */
+    int         profileInterval;            /* Calls and branches between profiler samples */
 
     void        (*defineParams)(void *handle);
     void        (*discardOutput)(void *handle);
     void        (*error)(void *handle, int code, cchar *fmt, ...);
     cchar       *(*getHeader)(void *handle, cchar *key);
+    void        (*getPoolLimits)(void *handle, int *size, int *recycle);
     EjsVar      *(*getVar)(void *handle, int collection, int field);
     void        (*redirect)(void *handle, int code, cchar *url);
     void        (*setCookie)(void *handle, cchar *name, cchar *value, cchar *path, cchar *domain, int lifetime, bool secure);
@@ -120,6 +124,9 @@ typedef struct EjsWeb {
     EjsType         *controllerType;/* Controller type instance */
     EjsVar          *controller;    /* Controller instance to run */
     EjsVar          *doAction;      /* doAction() function to run. May be renderView() for Stand-Alone views. */
+    struct EjsWebInterp *interp;    /* Pooled interpreter running the request */
+    int             poolSize;       /* Max idle interpreters per application. Zero disables pooling */
+    int             poolRecycle;    /* Requests before a pooled interpreter is recycled. Zero for no limit */
 
 } EjsWeb;
 
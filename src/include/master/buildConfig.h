@@ -83,6 +83,7 @@
     #define BLD_FEATURE_EJS_DOC 1
     #define BLD_FEATURE_EJS_E4X 1
     #define BLD_FEATURE_EJS_LANG EJS_LANG_FIXED
+    #define BLD_FEATURE_EJS_OPSTATS 0
     #define BLD_FEATURE_EJS_WEB 1
     #define BLD_FEATURE_HTTP 1
     #define BLD_FEATURE_HTTP_CLIENT 1
@@ -1219,61 +1219,298 @@ static EjsVar *sliceArray(Ejs *ejs, EjsArray *ap, int argc, EjsVar **argv)
 }
 
 
-static int partition(Ejs *ejs, EjsVar **data, int dir, int p, int r)
+/*
+ *  Array sorting. This is a stable merge sort that finds the natural runs in the data (timsort). Short runs are 
+ *  extended with a binary insertion sort. Runs are kept on a stack whose lengths grow faster than the Fibonacci 
+ *  sequence, so the stack is O(log n) and sorted or reversed input is sorted with n - 1 comparisons.
+ */
+#define SORT_MAX_RUNS   64
+
+typedef struct SortItem {
+    EjsVar          *value;
+    EjsString       *key;               /* Cached string key for the default comparison */
+} SortItem;
+
+typedef struct SortState {
+    Ejs             *ejs;
+    EjsFunction     *compare;           /* User comparator. Null for the default string comparison */
+    EjsVar          *argv[2];           /* Comparator arguments reused for each call */
+    SortItem        *tmp;               /* Merge buffer */
+    int             dir;                /* 1 for ascending, -1 for descending */
+    int             numRuns;
+    int             runBase[SORT_MAX_RUNS];
+    int             runLen[SORT_MAX_RUNS];
+} SortState;
+
+
+/*
+ *  Compare two items. An exception thrown by the comparator is left in ejs->exception and the result is zero.
+ */
+static int compareItems(SortState *ss, SortItem *a, SortItem *b)
 {
-    EjsVar          *tmp, *x;
-    EjsString       *sx, *so;
-    int             i, j, rc;
+    Ejs         *ejs;
+    EjsVar      *result;
+    EjsNumber   *np;
+    MprNumber   value;
 
-    x = data[r];
-    j = p - 1;
-    if ((sx = ejsToString(ejs, x)) == 0) {
+    if (ss->compare == 0) {
+        return strcmp(a->key->value, b->key->value) * ss->dir;
+    }
+    ejs = ss->ejs;
+    ss->argv[0] = a->value;
+    ss->argv[1] = b->value;
+    if ((result = ejsRunFunction(ejs, ss->compare, 0, 2, ss->argv)) == 0 || ejs->exception) {
         return 0;
     }
-    for (i = p; i < r; i++) {
-        if ((so = ejsToString(ejs, data[i])) == 0) {
-            return 0;
+    if (ejsIsNumber(result)) {
+        value = ((EjsNumber*) result)->value;
+    } else {
+        np = ejsToNumber(ejs, result);
+        value = (np) ? np->value : 0;
+    }
+    if (value < 0) {
+        return -ss->dir;
+    } else if (value > 0) {
+        return ss->dir;
+    }
+    return 0;
+}
+
+
+/*
+ *  Sort items[lo..hi) of which items[lo..start) are already sorted
+ */
+static int insertionSort(SortState *ss, SortItem *items, int lo, int hi, int start)
+{
+    SortItem    pivot;
+    int         left, right, mid;
+
+    for (; start < hi; start++) {
+        pivot = items[start];
+        left = lo;
+        right = start;
+        while (left < right) {
+            mid = (left + right) >> 1;
+            if (compareItems(ss, &pivot, &items[mid]) < 0) {
+                right = mid;
+            } else {
+                left = mid + 1;
+            }
+            if (ss->ejs->exception) {
+                return EJS_ERR;
+            }
         }
-        rc = strcmp(sx->value, so->value) * dir;
-        if (rc > 0) {
-            j = j + 1;
-            tmp = data[j];
-            data[j] = data[i];
-            data[i] = tmp;
+        memmove(&items[left + 1], &items[left], (start - left) * sizeof(SortItem));
+        items[left] = pivot;
+    }
+    return 0;
+}
+
+
+/*
+ *  Return the length of the run starting at lo. Strictly descending runs are reversed so the sort remains stable.
+ */
+static int countRun(SortState *ss, SortItem *items, int lo, int hi)
+{
+    SortItem    tmp;
+    int         runHi, i, j;
+
+    runHi = lo + 1;
+    if (runHi == hi) {
+        return 1;
+    }
+    if (compareItems(ss, &items[runHi++], &items[lo]) < 0) {
+        while (runHi < hi && compareItems(ss, &items[runHi], &items[runHi - 1]) < 0) {
+            runHi++;
+        }
+        for (i = lo, j = runHi - 1; i < j; i++, j--) {
+            tmp = items[i];
+            items[i] = items[j];
+            items[j] = tmp;
+        }
+    } else {
+        while (runHi < hi && compareItems(ss, &items[runHi], &items[runHi - 1]) >= 0) {
+            runHi++;
         }
     }
-    data[r] = data[j + 1];
-    data[j + 1] = x;
-    return j + 1;
+    return (ss->ejs->exception) ? EJS_ERR : runHi - lo;
 }
 
 
-void quickSort(Ejs *ejs, EjsArray *ap, int dir, int p, int r)
+/*
+ *  Merge the adjacent sorted runs items[base..base+len1) and items[base+len1..base+len1+len2)
+ */
+static int mergeRuns(SortState *ss, SortItem *items, int base, int len1, int len2)
 {
-    int     q;
+    SortItem    *tmp, *right, *end, *dest;
+    int         left, count, rc;
+
+    if (compareItems(ss, &items[base + len1 - 1], &items[base + len1]) <= 0) {
+        return (ss->ejs->exception) ? EJS_ERR : 0;
+    }
+    tmp = ss->tmp;
+    memcpy(tmp, &items[base], len1 * sizeof(SortItem));
+    dest = &items[base];
+    right = &items[base + len1];
+    end = &right[len2];
+    left = 0;
+    while (left < len1 && right < end) {
+        rc = compareItems(ss, right, &tmp[left]);
+        if (ss->ejs->exception) {
+            break;
+        }
+        *dest++ = (rc < 0) ? *right++ : tmp[left++];
+    }
+    count = len1 - left;
+    memcpy(dest, &tmp[left], count * sizeof(SortItem));
+    return (ss->ejs->exception) ? EJS_ERR : 0;
+}
+
 
-    if (p < r) {
-        q = partition(ejs, ap->data, dir, p, r);
-        quickSort(ejs, ap, dir, p, q - 1);
-        quickSort(ejs, ap, dir, q + 1, r);
+static int mergeAt(SortState *ss, SortItem *items, int i)
+{
+    if (mergeRuns(ss, items, ss->runBase[i], ss->runLen[i], ss->runLen[i + 1]) < 0) {
+        return EJS_ERR;
+    }
+    ss->runLen[i] += ss->runLen[i + 1];
+    if (i == ss->numRuns - 3) {
+        ss->runBase[i + 1] = ss->runBase[i + 2];
+        ss->runLen[i + 1] = ss->runLen[i + 2];
     }
+    ss->numRuns--;
+    return 0;
+}
+
+
+/*
+ *  Merge runs until the run lengths satisfy len[i - 2] > len[i - 1] + len[i] and len[i - 1] > len[i]
+ */
+static int collapseRuns(SortState *ss, SortItem *items, int force)
+{
+    int     *len, n;
+
+    len = ss->runLen;
+    while (ss->numRuns > 1) {
+        n = ss->numRuns - 2;
+        if (force) {
+            if (n > 0 && len[n - 1] < len[n + 1]) {
+                n--;
+            }
+        } else if ((n > 0 && len[n - 1] <= len[n] + len[n + 1]) || (n > 1 && len[n - 2] <= len[n - 1] + len[n])) {
+            if (len[n - 1] < len[n + 1]) {
+                n--;
+            }
+        } else if (len[n] > len[n + 1]) {
+            break;
+        }
+        if (mergeAt(ss, items, n) < 0) {
+            return EJS_ERR;
+        }
+    }
+    return 0;
+}
+
+
+/*
+ *  Compute the minimum run length. This is between EJS_SORT_MIN_RUN / 2 and EJS_SORT_MIN_RUN so that n / minRun is
+ *  close to a power of two and the final merges are balanced.
+ */
+static int minRunLength(int n)
+{
+    int     r;
+
+    r = 0;
+    while (n >= EJS_SORT_MIN_RUN) {
+        r |= (n & 1);
+        n >>= 1;
+    }
+    return n + r;
+}
+
+
+static int sortItems(SortState *ss, SortItem *items, int count)
+{
+    int     lo, remaining, minRun, runLen, forced;
+
+    minRun = minRunLength(count);
+    for (lo = 0, remaining = count; remaining > 0; lo += runLen, remaining -= runLen) {
+        if ((runLen = countRun(ss, items, lo, count)) < 0) {
+            return EJS_ERR;
+        }
+        if (runLen < minRun) {
+            forced = min(minRun, remaining);
+            if (insertionSort(ss, items, lo, lo + forced, lo + runLen) < 0) {
+                return EJS_ERR;
+            }
+            runLen = forced;
+        }
+        ss->runBase[ss->numRuns] = lo;
+        ss->runLen[ss->numRuns++] = runLen;
+        if (collapseRuns(ss, items, 0) < 0) {
+            return EJS_ERR;
+        }
+    }
+    return collapseRuns(ss, items, 1);
 }
 
 
 /**
  *  Sort the array using the supplied compare function
  *  intrinsic native function sort(compare: Function = null, order: Number = 1): Array
+ *
+ *  The elements and their keys are held in temporary arrays that are immune from GC while the sort runs, as a 
+ *  comparator or toString method may run script that modifies the array.
  */
 static EjsVar *sortArray(Ejs *ejs, EjsArray *ap, int argc, EjsVar **argv)
 {
-    int     direction;
+    SortState   ss;
+    SortItem    *items;
+    EjsArray    *values, *keys;
+    EjsVar      *vp;
+    int         count, i;
 
     if (ap->length <= 1) {
         return (EjsVar*) ap;
     }
-    direction = (argc >= 2) ? ejsGetInt(argv[1]) : 1;
-    quickSort(ejs, ap, direction, 0, ap->length - 1);
-    return (EjsVar*) ap;
+    memset(&ss, 0, sizeof(ss));
+    ss.ejs = ejs;
+    ss.compare = (argc >= 1 && ejsIsFunction(argv[0])) ? (EjsFunction*) argv[0] : NULL;
+    ss.dir = (argc >= 2 && ejsGetInt(argv[1]) < 0) ? -1 : 1;
+    count = ap->length;
+
+    if ((values = ejsCreateArray(ejs, count)) == 0 || (keys = ejsCreateArray(ejs, ss.compare ? 0 : count)) == 0 ||
+            (items = mprAlloc(ap, count * 2 * (int) sizeof(SortItem))) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    memcpy(values->data, ap->data, count * sizeof(EjsVar*));
+    ejsMakePermanent(ejs, (EjsVar*) values);
+    ejsMakePermanent(ejs, (EjsVar*) keys);
+    ss.tmp = &items[count];
+
+    for (i = 0; i < count; i++) {
+        vp = values->data[i] ? values->data[i] : ejs->undefinedValue;
+        items[i].value = vp;
+        items[i].key = 0;
+        if (ss.compare == 0) {
+            if ((items[i].key = ejsIsString(vp) ? (EjsString*) vp : ejsToString(ejs, vp)) == 0) {
+                break;
+            }
+            keys->data[i] = (EjsVar*) items[i].key;
+            ejsWriteBarrier(ejs, keys, items[i].key);
+        }
+    }
+    if (i == count && sortItems(&ss, items, count) == 0 && !ejs->exception) {
+        count = min(count, ap->length);
+        for (i = 0; i < count; i++) {
+            ap->data[i] = items[i].value;
+            ejsWriteBarrier(ejs, ap, items[i].value);
+        }
+    }
+    ejsMakeTransient(ejs, (EjsVar*) values);
+    ejsMakeTransient(ejs, (EjsVar*) keys);
+    mprFree(items);
+    return (ejs->exception) ? 0 : (EjsVar*) ap;
 }
 
 
@@ -110,10 +110,13 @@ void ejsMarkBlock(Ejs *ejs, EjsVar *parent, EjsBlock *block)
             ejsMarkVar(ejs, (EjsVar*) block, item);
         }
     }
-    for (b = block->scopeChain; b; b = b->scopeChain) {
+    /*
+     *  Frames on the frame stack are marked via the active block chain. Stop at them as a heap block may outlive them.
+     */
+    for (b = block->scopeChain; b && !ejsIsStackFrame(ejs, b); b = b->scopeChain) {
         ejsMarkVar(ejs, (EjsVar*) block, (EjsVar*) b);
     }
-    for (b = block->prev; b; b = b->prev) {
+    for (b = block->prev; b && !ejsIsStackFrame(ejs, b); b = b->prev) {
         ejsMarkVar(ejs, (EjsVar*) block, (EjsVar*) b);
     }
 }
@@ -352,6 +355,7 @@ int ejsInheritTraits(Ejs *ejs, EjsBlock *block, EjsBlock *baseBlock, int count,
         return 0;
     }
     block->numInherited += count;
+    ejsResetInlineCache(ejs);
     
     mprAssert(block->numInherited <= block->numTraits);
     mprAssert(block->numTraits <= block->sizeTraits);
@@ -794,6 +794,35 @@ static EjsVar *readLong(Ejs *ejs, EjsByteArray *ap, int argc, EjsVar **argv)
 }
 
 
+/*
+ *  Read an object encoded by writeObject. Data is read from the current read position.
+ *
+ *  function readObject(): Object
+ */
+static EjsVar *readObject(Ejs *ejs, EjsByteArray *ap, int argc, EjsVar **argv)
+{
+    EjsVar  *vp;
+    int     len;
+
+    if (getInput(ejs, ap, EJS_SIZE_INT) <= 0) {
+        return (EjsVar*) ejs->nullValue;
+    }
+    len = swap32(ap, * (int*) &ap->value[ap->readPosition]);
+    if (len <= 0) {
+        ejsThrowIOError(ejs, "Bad object length");
+        return 0;
+    }
+    if (getInput(ejs, ap, EJS_SIZE_INT + len) <= 0) {
+        return (EjsVar*) ejs->nullValue;
+    }
+    if ((vp = ejsDecodeClone(ejs, (cchar*) &ap->value[ap->readPosition + EJS_SIZE_INT], len, 0)) == 0) {
+        return 0;
+    }
+    adjustReadPosition(ap, EJS_SIZE_INT + len);
+    return vp;
+}
+
+
 /*
  *  Get the current read position offset
  *
@@ -1114,6 +1143,30 @@ static EjsVar *writeLong(Ejs *ejs, EjsByteArray *ap, int argc, EjsVar **argv)
 }
 
 
+/*
+ *  Write an object to the array using the structured clone encoding. The encoding is prefixed by its length as a 
+ *  32-bit integer.
+ *
+ *  function writeObject(obj: Object): Void
+ */
+static EjsVar *writeObject(Ejs *ejs, EjsByteArray *ap, int argc, EjsVar **argv)
+{
+    MprBuf  *buf;
+    int     len;
+
+    if ((buf = ejsEncodeClone(ejs, ap, argv[0], NULL)) == 0) {
+        return 0;
+    }
+    len = mprGetBufLength(buf);
+    if (makeRoom(ejs, ap, EJS_SIZE_INT + len)) {
+        putInteger(ap, len);
+        putString(ap, mprGetBufStart(buf), len);
+    }
+    mprFree(buf);
+    return 0;
+}
+
+
 /*
  *  Get the current write position offset
  *
@@ -1419,6 +1472,661 @@ int ejsGetAvailableData(EjsByteArray *ap)
     return availableBytes(ap);
 }
 
+/*********************************** Cloning **********************************/
+/*
+ *  Structured clone encoding. This is a compact binary serialization used to pass values between interpreters and
+ *  to store values in ByteArrays. Strings are length prefixed, numbers are zig-zag varints where they are integral
+ *  and arrays, objects and byte arrays that have already been encoded are written as back references. This preserves
+ *  shared objects and cycles. All multi-byte quantities are little endian.
+ */
+#define CLONE_VERSION       1
+
+#define CLONE_UNDEFINED     0
+#define CLONE_NULL          1
+#define CLONE_FALSE         2
+#define CLONE_TRUE          3
+#define CLONE_INT           4           /* Zig-zag varint */
+#define CLONE_DOUBLE        5           /* 8 byte IEEE double */
+#define CLONE_STRING        6           /* Varint length, bytes */
+#define CLONE_DATE          7           /* Zig-zag varint milliseconds */
+#define CLONE_ARRAY         8           /* Varint length, elements */
+#define CLONE_OBJECT        9           /* Varint size hint, (name, value) pairs, empty name */
+#define CLONE_BYTES         10          /* Varint read position, varint write position, bytes */
+#define CLONE_REF           11          /* Varint index of an earlier array, object or byte array */
+#define CLONE_JSON          12          /* Varint length, text from a type's toJSON */
+#define CLONE_TRANSFER      13          /* Read and write positions, length, growable, buffer address */
+
+#define CLONE_MAX_INT       9007199254740992.0      /* 2^53. Larger integers aren't exact in a double */
+
+typedef struct CloneRef {
+    EjsVar          *vp;
+    int             index;
+} CloneRef;
+
+typedef struct CloneEncoder {
+    MprBuf          *buf;
+    CloneRef        *refs;              /* Open addressed hash of encoded containers */
+    int             refSize;            /* Size of refs. Always a power of two */
+    int             refCount;
+    EjsArray        *transfer;          /* Byte arrays whose buffers are moved rather than copied */
+    EjsFunction     *objectToJson;
+} CloneEncoder;
+
+typedef struct CloneDecoder {
+    cuchar          *next;
+    cuchar          *end;
+    MprCtx          ctx;
+    EjsVar          **refs;             /* Decoded containers in order */
+    int             refSize;
+    int             refCount;
+    int             depth;
+    bool            transfer;           /* Accept transferred buffers */
+} CloneDecoder;
+
+static int encodeClone(Ejs *ejs, CloneEncoder *ce, EjsVar *vp);
+static EjsVar *decodeClone(Ejs *ejs, CloneDecoder *cd);
+
+
+static void putVarint(MprBuf *buf, uint64 value)
+{
+    while (value >= 0x80) {
+        mprPutCharToBuf(buf, (int) ((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    mprPutCharToBuf(buf, (int) value);
+}
+
+
+static void putTaggedBlock(MprBuf *buf, int tag, cchar *data, int len)
+{
+    mprPutCharToBuf(buf, tag);
+    putVarint(buf, len);
+    mprPutBlockToBuf(buf, data, len);
+}
+
+
+/*
+ *  Zig-zag encode a signed integer so small negative values have short varints
+ */
+static MPR_INLINE uint64 zigzag(int64 n)
+{
+    return ((uint64) n << 1) ^ (uint64) -(n < 0);
+}
+
+
+static void encodeNumber(CloneEncoder *ce, MprNumber value)
+{
+#if BLD_FEATURE_FLOATING_POINT
+    union {
+        double  d;
+        uint64  i;
+    } u;
+    int     i;
+
+    /*
+     *  Only integers of at most 53 bits are encoded as integers. The range is tested first as converting NaN, 
+     *  infinities or out of range values to an integer is undefined.
+     */
+    if (!(value >= -CLONE_MAX_INT && value <= CLONE_MAX_INT && value == floor(value)) || 
+            (value == 0 && signbit(value))) {
+        u.d = value;
+        mprPutCharToBuf(ce->buf, CLONE_DOUBLE);
+        for (i = 0; i < 8; i++) {
+            mprPutCharToBuf(ce->buf, (int) ((u.i >> (i * 8)) & 0xFF));
+        }
+        return;
+    }
+#endif
+    mprPutCharToBuf(ce->buf, CLONE_INT);
+    putVarint(ce->buf, zigzag((int64) value));
+}
+
+
+/*
+ *  Lookup a container in the encoded set. If not present, add it and return -1. Otherwise return its index.
+ */
+static int addRef(CloneEncoder *ce, EjsVar *vp)
+{
+    CloneRef    *refs, *rp;
+    int         i, size, mask;
+
+    if (ce->refCount * 2 >= ce->refSize) {
+        size = ce->refSize ? ce->refSize * 2 : 32;
+        if ((refs = mprAllocZeroed(ce->buf, size * (int) sizeof(CloneRef))) == 0) {
+            return EJS_ERR;
+        }
+        for (i = 0; i < ce->refSize; i++) {
+            if (ce->refs[i].vp) {
+                for (rp = &refs[(((size_t) ce->refs[i].vp) >> 3) & (size - 1)]; rp->vp; ) {
+                    rp = (rp == &refs[size - 1]) ? refs : rp + 1;
+                }
+                *rp = ce->refs[i];
+            }
+        }
+        mprFree(ce->refs);
+        ce->refs = refs;
+        ce->refSize = size;
+    }
+    mask = ce->refSize - 1;
+    for (i = (((size_t) vp) >> 3) & mask; ce->refs[i].vp; i = (i + 1) & mask) {
+        if (ce->refs[i].vp == vp) {
+            return ce->refs[i].index;
+        }
+    }
+    ce->refs[i].vp = vp;
+    ce->refs[i].index = ce->refCount++;
+    return -1;
+}
+
+
+/*
+ *  Get a property to encode. Functions, hidden and private properties and those without a name are skipped.
+ */
+static EjsVar *getClonedProperty(Ejs *ejs, EjsVar *vp, int slotNum, EjsName *qname)
+{
+    EjsVar      *pp;
+
+    pp = ejsGetProperty(ejs, vp, slotNum);
+    if (pp == 0 || pp->hidden || ejsIsFunction(pp)) {
+        return 0;
+    }
+    *qname = ejsGetPropertyName(ejs, vp, slotNum);
+    if (qname->name == 0 || qname->name[0] == '\0' || (qname->space && strstr(qname->space, ",private") != 0)) {
+        return 0;
+    }
+    return pp;
+}
+
+
+/*
+ *  Encode the enumerable data properties of an object. Property names are written without their namespaces. The
+ *  count of encoded properties is written first so the decoder can size the object.
+ */
+static int encodeObjectClone(Ejs *ejs, CloneEncoder *ce, EjsVar *vp)
+{
+    EjsVar      *pp;
+    EjsName     qname;
+    int         count, slotNum, numInherited, numMembers;
+
+    count = ejsGetPropertyCount(ejs, vp);
+    numInherited = ejsIsBlock(vp) ? ejsGetNumInheritedTraits((EjsBlock*) vp) : 0;
+
+    for (numMembers = 0, slotNum = numInherited; slotNum < count; slotNum++) {
+        if (getClonedProperty(ejs, vp, slotNum, &qname)) {
+            numMembers++;
+        }
+        if (ejs->exception) {
+            return EJS_ERR;
+        }
+    }
+    mprPutCharToBuf(ce->buf, CLONE_OBJECT);
+    putVarint(ce->buf, numMembers);
+    for (slotNum = numInherited; slotNum < count; slotNum++) {
+        if ((pp = getClonedProperty(ejs, vp, slotNum, &qname)) == 0) {
+            continue;
+        }
+        putVarint(ce->buf, strlen(qname.name));
+        mprPutStringToBuf(ce->buf, qname.name);
+        if (encodeClone(ejs, ce, pp) < 0) {
+            return EJS_ERR;
+        }
+    }
+    mprPutCharToBuf(ce->buf, 0);
+    return 0;
+}
+
+
+static bool isTransferred(CloneEncoder *ce, EjsVar *vp)
+{
+    int     i;
+
+    if (ce->transfer) {
+        for (i = 0; i < ce->transfer->length; i++) {
+            if (ce->transfer->data[i] == vp) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+static int encodeClone(Ejs *ejs, CloneEncoder *ce, EjsVar *vp)
+{
+    EjsFunction     *fn;
+    EjsByteArray    *ap;
+    EjsString       *sp;
+    MprTime         when;
+    int             i, count, index;
+
+    if (vp == 0 || vp == ejs->undefinedValue) {
+        mprPutCharToBuf(ce->buf, CLONE_UNDEFINED);
+        return 0;
+    } else if (vp == ejs->nullValue) {
+        mprPutCharToBuf(ce->buf, CLONE_NULL);
+        return 0;
+    } else if (ejsIsBoolean(vp)) {
+        mprPutCharToBuf(ce->buf, ((EjsBoolean*) vp)->value ? CLONE_TRUE : CLONE_FALSE);
+        return 0;
+    } else if (ejsIsNumber(vp)) {
+        encodeNumber(ce, ((EjsNumber*) vp)->value);
+        return 0;
+    } else if (ejsIsString(vp)) {
+        putTaggedBlock(ce->buf, CLONE_STRING, ((EjsString*) vp)->value, ((EjsString*) vp)->length);
+        return 0;
+    } else if (ejsIsDate(vp)) {
+        when = ((EjsDate*) vp)->value;
+        mprPutCharToBuf(ce->buf, CLONE_DATE);
+        putVarint(ce->buf, zigzag(when));
+        return 0;
+    }
+
+    if ((fn = (EjsFunction*) ejsGetProperty(ejs, (EjsVar*) vp->type, ES_Object_toJSON)) != ce->objectToJson && 
+            !ejsIsByteArray(vp)) {
+        /*
+         *  Types with their own JSON encoding are cloned via that encoding
+         */
+        sp = (ejsIsFunction(fn)) ? (EjsString*) ejsRunFunction(ejs, fn, vp, 0, NULL) : ejsToString(ejs, vp);
+        if (sp == 0 || !ejsIsString(sp)) {
+            return EJS_ERR;
+        }
+        putTaggedBlock(ce->buf, CLONE_JSON, sp->value, sp->length);
+        return 0;
+    }
+    if ((index = addRef(ce, vp)) >= 0) {
+        mprPutCharToBuf(ce->buf, CLONE_REF);
+        putVarint(ce->buf, index);
+        return 0;
+    }
+    if (ejsIsByteArray(vp) && isTransferred(ce, vp)) {
+        /*
+         *  The buffer is detached from the byte array once encoding completes and is owned by the encoding
+         */
+        ap = (EjsByteArray*) vp;
+        mprPutCharToBuf(ce->buf, CLONE_TRANSFER);
+        putVarint(ce->buf, ap->readPosition);
+        putVarint(ce->buf, ap->writePosition);
+        putVarint(ce->buf, ap->length);
+        mprPutCharToBuf(ce->buf, ap->growable);
+        mprPutBlockToBuf(ce->buf, (cchar*) &ap->value, (int) sizeof(uchar*));
+        return 0;
+
+    } else if (ejsIsByteArray(vp)) {
+        ap = (EjsByteArray*) vp;
+        mprPutCharToBuf(ce->buf, CLONE_BYTES);
+        putVarint(ce->buf, ap->readPosition);
+        putVarint(ce->buf, ap->writePosition);
+        mprPutBlockToBuf(ce->buf, (cchar*) ap->value, ap->writePosition);
+        return 0;
+
+    } else if (ejsIsArray(vp)) {
+        count = ((EjsArray*) vp)->length;
+        mprPutCharToBuf(ce->buf, CLONE_ARRAY);
+        putVarint(ce->buf, count);
+        for (i = 0; i < count; i++) {
+            if (encodeClone(ejs, ce, ((EjsArray*) vp)->data[i]) < 0) {
+                return EJS_ERR;
+            }
+        }
+        return 0;
+
+    } else if (ejsGetPropertyCount(ejs, vp) == 0 && vp->type != ejs->objectType) {
+        if ((sp = ejsToString(ejs, vp)) == 0) {
+            return EJS_ERR;
+        }
+        putTaggedBlock(ce->buf, CLONE_STRING, sp->value, sp->length);
+        return 0;
+    }
+    return encodeObjectClone(ejs, ce, vp);
+}
+
+
+/*
+ *  Move the buffers of transferred byte arrays to the encoding. The byte arrays are left empty.
+ */
+static void detachTransfers(CloneEncoder *ce)
+{
+    EjsByteArray    *ap;
+    int             i;
+
+    for (i = 0; i < ce->transfer->length; i++) {
+        ap = (EjsByteArray*) ce->transfer->data[i];
+        if (ap->value) {
+            mprStealBlock(ce->buf, ap->value);
+            ap->value = 0;
+        }
+        ap->length = ap->readPosition = ap->writePosition = 0;
+    }
+}
+
+
+/*
+ *  Encode a value using the structured clone format. The encoding is returned in a buffer allocated from the given 
+ *  memory context. Byte arrays in the optional transfer list are not copied. Their buffers are moved to the encoding
+ *  and the byte arrays are emptied. Such encodings can only be decoded once, by ejsDecodeClone with transfer set. 
+ *  Returns null and throws an exception if the value can't be encoded.
+ */
+MprBuf *ejsEncodeClone(Ejs *ejs, MprCtx ctx, EjsVar *vp, EjsArray *transfer)
+{
+    CloneEncoder    ce;
+    int             i;
+
+    memset(&ce, 0, sizeof(ce));
+    if (transfer) {
+        for (i = 0; i < transfer->length; i++) {
+            if (!ejsIsByteArray(transfer->data[i])) {
+                ejsThrowArgError(ejs, "Only byte arrays can be transferred");
+                return 0;
+            }
+        }
+        ce.transfer = transfer;
+    }
+    if ((ce.buf = mprCreateBuf(ctx, EJS_JSON_BUF_SIZE, 0)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    ce.objectToJson = (EjsFunction*) ejsGetProperty(ejs, (EjsVar*) ejs->objectType, ES_Object_toJSON);
+    mprPutCharToBuf(ce.buf, CLONE_VERSION);
+    if (encodeClone(ejs, &ce, vp) < 0 || ejs->exception) {
+        if (!ejs->exception) {
+            ejsThrowTypeError(ejs, "Can't clone object");
+        }
+        mprFree(ce.buf);
+        return 0;
+    }
+    mprFree(ce.refs);
+    ce.refs = 0;
+    if (transfer) {
+        detachTransfers(&ce);
+    }
+    return ce.buf;
+}
+
+
+static int getVarint(CloneDecoder *cd, uint64 *value)
+{
+    uint64  result;
+    int     shift, c;
+
+    result = 0;
+    for (shift = 0; cd->next < cd->end && shift < 64; shift += 7) {
+        c = *cd->next++;
+        result |= ((uint64) (c & 0x7F)) << shift;
+        if (!(c & 0x80)) {
+            *value = result;
+            return 0;
+        }
+    }
+    return EJS_ERR;
+}
+
+
+/*
+ *  Get a length or index that must fit in the remaining input
+ */
+static int getLength(CloneDecoder *cd, int *len)
+{
+    uint64  value;
+
+    if (getVarint(cd, &value) < 0 || value > (uint64) (cd->end - cd->next)) {
+        return EJS_ERR;
+    }
+    *len = (int) value;
+    return 0;
+}
+
+
+static int addDecodedRef(CloneDecoder *cd, EjsVar *vp)
+{
+    EjsVar  **refs;
+    int     size;
+
+    if (cd->refCount >= cd->refSize) {
+        size = cd->refSize ? cd->refSize * 2 : 32;
+        if ((refs = mprRealloc(cd->ctx, cd->refs, size * (int) sizeof(EjsVar*))) == 0) {
+            return EJS_ERR;
+        }
+        cd->refs = refs;
+        cd->refSize = size;
+    }
+    cd->refs[cd->refCount++] = vp;
+    return 0;
+}
+
+
+static EjsVar *decodeObjectClone(Ejs *ejs, CloneDecoder *cd)
+{
+    EjsObject   *obj;
+    EjsVar      *vp;
+    char        *name;
+    int         size, len;
+
+    if (getLength(cd, &size) < 0) {
+        return 0;
+    }
+    if ((obj = ejsCreateObject(ejs, ejs->objectType, 0)) == 0 || ejsReserveObjectSlots(ejs, obj, size) < 0 ||
+            addDecodedRef(cd, (EjsVar*) obj) < 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    while (1) {
+        if (getLength(cd, &len) < 0) {
+            return 0;
+        }
+        if (len == 0) {
+            break;
+        }
+        if ((name = mprAlloc(obj, len + 1)) == 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+        memcpy(name, cd->next, len);
+        name[len] = '\0';
+        cd->next += len;
+        if ((vp = decodeClone(ejs, cd)) == 0) {
+            return 0;
+        }
+        if (ejsSetPropertyByAllocatedName(ejs, obj, 0, name, vp) < 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+    }
+    return (EjsVar*) obj;
+}
+
+
+static EjsVar *decodeClone(Ejs *ejs, CloneDecoder *cd)
+{
+    EjsArray        *array;
+    EjsByteArray    *ap;
+    EjsVar          *vp;
+    EjsString       *sp;
+    uint64          value, position, limit;
+    uchar           *data;
+    int             tag, len, readPosition, writePosition, growable, i;
+
+    if (cd->next >= cd->end || cd->depth >= EJS_MAX_CLONE_DEPTH) {
+        return 0;
+    }
+    tag = *cd->next++;
+    switch (tag) {
+    case CLONE_UNDEFINED:
+        return ejs->undefinedValue;
+
+    case CLONE_NULL:
+        return ejs->nullValue;
+
+    case CLONE_FALSE:
+        return (EjsVar*) ejs->falseValue;
+
+    case CLONE_TRUE:
+        return (EjsVar*) ejs->trueValue;
+
+    case CLONE_INT:
+        if (getVarint(cd, &value) < 0) {
+            return 0;
+        }
+        return (EjsVar*) ejsCreateNumber(ejs, (MprNumber) ((int64) (value >> 1) ^ -((int64) (value & 1))));
+
+#if BLD_FEATURE_FLOATING_POINT
+    case CLONE_DOUBLE: {
+        union {
+            double  d;
+            uint64  i;
+        } u;
+        if (cd->end - cd->next < 8) {
+            return 0;
+        }
+        for (u.i = 0, i = 0; i < 8; i++) {
+            u.i |= ((uint64) *cd->next++) << (i * 8);
+        }
+        return (EjsVar*) ejsCreateNumber(ejs, u.d);
+    }
+#endif
+
+    case CLONE_STRING:
+    case CLONE_JSON:
+        if (getLength(cd, &len) < 0) {
+            return 0;
+        }
+        sp = ejsCreateStringWithLength(ejs, (cchar*) cd->next, len);
+        cd->next += len;
+        if (sp == 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+        return (tag == CLONE_JSON) ? ejsDeserialize(ejs, sp) : (EjsVar*) sp;
+
+    case CLONE_DATE:
+        if (getVarint(cd, &value) < 0) {
+            return 0;
+        }
+        return (EjsVar*) ejsCreateDate(ejs, (MprTime) ((int64) (value >> 1) ^ -((int64) (value & 1))));
+
+    case CLONE_REF:
+        if (getVarint(cd, &value) < 0 || value >= (uint64) cd->refCount) {
+            return 0;
+        }
+        return cd->refs[(int) value];
+
+    case CLONE_BYTES:
+        if (getLength(cd, &readPosition) < 0 || getLength(cd, &len) < 0 || readPosition > len) {
+            return 0;
+        }
+        if ((ap = ejsCreateByteArray(ejs, len)) == 0 || addDecodedRef(cd, (EjsVar*) ap) < 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+        memcpy(ap->value, cd->next, len);
+        cd->next += len;
+        ap->readPosition = readPosition;
+        ap->writePosition = len;
+        return (EjsVar*) ap;
+
+    case CLONE_TRANSFER:
+        if (!cd->transfer || getVarint(cd, &position) < 0 || getVarint(cd, &limit) < 0 || getVarint(cd, &value) < 0) {
+            return 0;
+        }
+        if (position > limit || limit > value || value > MAXINT || (cd->end - cd->next) < (int) (1 + sizeof(uchar*))) {
+            return 0;
+        }
+        readPosition = (int) position;
+        writePosition = (int) limit;
+        growable = *cd->next++;
+        memcpy(&data, cd->next, sizeof(uchar*));
+        cd->next += sizeof(uchar*);
+        if ((ap = ejsCreateByteArray(ejs, data ? 1 : 0)) == 0 || addDecodedRef(cd, (EjsVar*) ap) < 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+        if (data) {
+            mprFree(ap->value);
+            mprStealBlock(ap, data);
+            ap->value = data;
+            ap->length = (int) value;
+            ap->readPosition = readPosition;
+            ap->writePosition = writePosition;
+            ap->growable = growable;
+        }
+        return (EjsVar*) ap;
+
+    case CLONE_ARRAY:
+        if (getLength(cd, &len) < 0) {
+            return 0;
+        }
+        if ((array = ejsCreateArray(ejs, len)) == 0 || addDecodedRef(cd, (EjsVar*) array) < 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+        cd->depth++;
+        for (i = 0; i < len; i++) {
+            if ((vp = decodeClone(ejs, cd)) == 0) {
+                return 0;
+            }
+            ejsSetProperty(ejs, (EjsVar*) array, i, vp);
+        }
+        cd->depth--;
+        return (EjsVar*) array;
+
+    case CLONE_OBJECT:
+        cd->depth++;
+        vp = decodeObjectClone(ejs, cd);
+        cd->depth--;
+        return vp;
+    }
+    return 0;
+}
+
+
+/*
+ *  Decode a value encoded by ejsEncodeClone. Transferred buffers are only accepted if transfer is set. The encoding 
+ *  must then come from ejsEncodeClone in this process and must not be decoded again. Returns null and throws an 
+ *  exception if the data is corrupt.
+ */
+EjsVar *ejsDecodeClone(Ejs *ejs, cchar *data, int len, bool transfer)
+{
+    CloneDecoder    cd;
+    EjsVar          *vp;
+
+    memset(&cd, 0, sizeof(cd));
+    cd.ctx = ejs;
+    cd.transfer = transfer;
+    cd.next = (cuchar*) data;
+    cd.end = cd.next + len;
+
+    vp = 0;
+    if (len > 0 && *cd.next++ == CLONE_VERSION) {
+        vp = decodeClone(ejs, &cd);
+    }
+    mprFree(cd.refs);
+    if ((vp == 0 || cd.next != cd.end) && !ejs->exception) {
+        ejsThrowSyntaxError(ejs, "Corrupt or unsupported clone data");
+    }
+    return (ejs->exception) ? 0 : vp;
+}
+
+
+/*
+ *  Encode a value into a new byte array owned by the given interpreter
+ */
+EjsByteArray *ejsCloneToByteArray(Ejs *ejs, Ejs *owner, EjsVar *vp)
+{
+    EjsByteArray    *ap;
+    MprBuf          *buf;
+    int             len;
+
+    if ((buf = ejsEncodeClone(ejs, ejs, vp, NULL)) == 0) {
+        return 0;
+    }
+    len = mprGetBufLength(buf);
+    if ((ap = ejsCreateByteArray(owner, len)) != 0) {
+        memcpy(ap->value, mprGetBufStart(buf), len);
+        ap->writePosition = len;
+    }
+    mprFree(buf);
+    return ap;
+}
+
 /*********************************** Factory **********************************/
 
 EjsByteArray *ejsCreateByteArray(Ejs *ejs, int size)
@@ -1504,6 +2212,7 @@ void ejsConfigureByteArrayType(Ejs *ejs)
 #endif
     ejsBindMethod(ejs, type, ES_ByteArray_readInteger, (EjsNativeFunction) readInteger);
     ejsBindMethod(ejs, type, ES_ByteArray_readLong, (EjsNativeFunction) readLong);
+    ejsBindMethod(ejs, type, ES_ByteArray_readObject, (EjsNativeFunction) readObject);
     ejsBindMethod(ejs, type, ES_ByteArray_readPosition, (EjsNativeFunction) readPosition);
     ejsBindMethod(ejs, type, ES_ByteArray_set_readPosition, (EjsNativeFunction) setReadPosition);
     ejsBindMethod(ejs, type, ES_ByteArray_readShort, (EjsNativeFunction) readShort);
@@ -1519,6 +2228,7 @@ void ejsConfigureByteArrayType(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ByteArray_writeShort, (EjsNativeFunction) writeShort);
     ejsBindMethod(ejs, type, ES_ByteArray_writeInteger, (EjsNativeFunction) writeInteger);
     ejsBindMethod(ejs, type, ES_ByteArray_writeLong, (EjsNativeFunction) writeLong);
+    ejsBindMethod(ejs, type, ES_ByteArray_writeObject, (EjsNativeFunction) writeObject);
 #if ES_ByteArray_writeDouble && BLD_FEATURE_FLOATING_POINT
     ejsBindMethod(ejs, type, ES_ByteArray_writeDouble, (EjsNativeFunction) writeDouble);
 #endif
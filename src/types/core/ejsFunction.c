@@ -97,7 +97,7 @@ static EjsFunction *cloneFunctionVar(Ejs *ejs, EjsFunction *src, bool deep)
 
 static void destroyFunction(Ejs *ejs, EjsFunction *fun)
 {
-    ejsFreeVar(ejs, (EjsVar*) fun, fun->isFrame ? ES_Frame : ES_Function);
+    ejsFreeVar(ejs, (EjsVar*) fun, -1);
 }
 
 void ejsMarkFunction(Ejs *ejs, EjsVar *parent, EjsFunction *fun)
@@ -116,7 +116,7 @@ void ejsMarkFunction(Ejs *ejs, EjsVar *parent, EjsFunction *fun)
     if (fun->thisObj) {
         ejsMarkVar(ejs, parent, fun->thisObj);
     }
-    if (fun->isFrame) {
+    if (fun->isFrame && !ejsIsStackFrame(ejs, ((EjsFrame*) fun)->caller)) {
         ejsMarkVar(ejs, parent, (EjsObj*) ((EjsFrame*) fun)->caller);
     }
 }
@@ -429,18 +429,17 @@ EjsFunction *ejsCopyFunction(Ejs *ejs, EjsFunction *src)
 static EjsFrame *allocFrame(Ejs *ejs, int numSlots)
 {
     EjsObject       *obj;
-    uint            size;
+    int             extra;
 
     mprAssert(ejs);
 
-    size = (int) (numSlots * sizeof(EjsVar*) + sizeof(EjsFrame));
-
-    if ((obj = (EjsObject*) mprAllocZeroed(ejsGetAllocCtx(ejs), size)) == 0) {
-        ejsThrowMemoryError(ejs);
+    /*
+     *  Frames are allocated from the size class free lists. They are recycled by ejsFreeVar.
+     */
+    extra = (int) (numSlots * sizeof(EjsVar*) + sizeof(EjsFrame)) - ejs->functionType->instanceSize;
+    if ((obj = (EjsObject*) ejsAllocVar(ejs, ejs->functionType, extra)) == 0) {
         return 0;
     }
-    obj->var.type = ejs->functionType;
-    obj->var.master = (ejs->master == 0);
     obj->var.isObject = 1;
     obj->var.dynamic = 1;
     obj->var.isFunction = 1;
@@ -448,26 +447,15 @@ static EjsFrame *allocFrame(Ejs *ejs, int numSlots)
     obj->slots = (EjsVar**) &(((char*) obj)[sizeof(EjsFrame)]);
     obj->capacity = numSlots;
     obj->numProp = numSlots;
-#if BLD_DEBUG
-    ejsAddToGcStats(ejs, (EjsVar*) obj, ES_Frame);
-#endif
     return (EjsFrame*) obj;
 }
 
 
 /*
- *  Fast allocation of a function activation frame
+ *  Initialize a frame from its function. The frame must be zeroed with room for numSlots slots.
  */
-EjsFrame *ejsCreateFrame(Ejs *ejs, EjsFunction *src)
+static EjsFrame *initFrame(Ejs *ejs, EjsFrame *frame, EjsFunction *src, int numSlots)
 {
-    EjsFrame    *frame;
-    int         numSlots;
-
-    numSlots = max(src->block.obj.numProp, EJS_MIN_FRAME_SLOTS);
-
-    if ((frame = (EjsFrame*) ejsAllocPooledVar(ejs, ES_Frame)) == 0) {
-        frame = allocFrame(ejs, numSlots);
-    }
     frame->function.block.obj.var.isObject = 1;
     frame->function.block.obj.var.dynamic = 1;
     frame->function.block.obj.var.isFunction = 1;
@@ -526,6 +514,133 @@ EjsFrame *ejsCreateFrame(Ejs *ejs, EjsFunction *src)
 }
 
 
+/*
+ *  Fast allocation of a function activation frame
+ */
+EjsFrame *ejsCreateFrame(Ejs *ejs, EjsFunction *src)
+{
+    EjsFrame    *frame;
+    int         numSlots;
+
+    numSlots = max(src->block.obj.numProp, EJS_MIN_FRAME_SLOTS);
+
+    if ((frame = allocFrame(ejs, numSlots)) == 0) {
+        return 0;
+    }
+    return initFrame(ejs, frame, src, numSlots);
+}
+
+
+/*
+ *  Push a frame onto the frame stack. Each frame is preceded by a memory block header so the frame can be used as a 
+ *  memory context like a heap frame. Children allocated off the frame (grown slots and names) are freed when the 
+ *  frame is popped. The header is not linked into its parent, so the frame is never seen by the garbage collector
+ *  sweep. The frame is marked via the block chain while active.
+ */
+EjsFrame *ejsPushFrame(Ejs *ejs, EjsFunction *src)
+{
+    EjsState    *state;
+    EjsFrame    *frame;
+    EjsObject   *obj;
+    MprBlk      *bp;
+    char        *top;
+    int         numSlots, size;
+
+    state = ejs->state;
+    top = state->frames;
+    numSlots = max(src->block.obj.numProp, EJS_MIN_FRAME_SLOTS);
+    size = MPR_ALLOC_HDR_SIZE + MPR_ALLOC_ALIGN((int) (sizeof(EjsFrame) + numSlots * sizeof(EjsVar*)));
+
+    if (top == 0 || (top + size) > state->framesEnd) {
+        if ((frame = ejsCreateFrame(ejs, src)) != 0) {
+            frame->frames = top;
+        }
+        return frame;
+    }
+    state->frames = top + size;
+
+    bp = (MprBlk*) top;
+    memset(bp, 0, size);
+    bp->parent = MPR_GET_BLK(ejsGetAllocCtx(ejs));
+    MPR_SET_SIZE(bp, size);
+#if BLD_FEATURE_MEMORY_DEBUG
+    bp->magic = MPR_ALLOC_MAGIC;
+#endif
+    obj = (EjsObject*) MPR_GET_PTR(bp);
+    obj->var.master = (ejs->master == 0);
+    obj->slots = (EjsVar**) &(((char*) obj)[sizeof(EjsFrame)]);
+    obj->capacity = numSlots;
+    obj->numProp = numSlots;
+
+    frame = initFrame(ejs, (EjsFrame*) obj, src, numSlots);
+    frame->frames = top;
+    return frame;
+}
+
+
+void ejsPopFrame(Ejs *ejs, EjsFrame *frame)
+{
+    if (ejsIsStackFrame(ejs, frame) && mprGetFirstChild(frame)) {
+        mprFreeChildren(frame);
+    }
+    ejs->state->frames = frame->frames;
+}
+
+
+/*
+ *  Copy the current frame to the heap because it is being captured. Frames above the current frame have already been 
+ *  popped, so only the interpreter state and the scope blocks opened in the current frame can refer to the frame.
+ */
+EjsFrame *ejsPromoteFrame(Ejs *ejs, EjsFrame *frame)
+{
+    EjsState    *state;
+    EjsFrame    *heapFrame;
+    EjsBlock    *block;
+    EjsVar      var;
+    MprBlk      *child;
+    int         capacity;
+
+    if (!ejsIsStackFrame(ejs, frame)) {
+        return frame;
+    }
+    state = ejs->state;
+    mprAssert(state->fp == frame);
+
+    capacity = frame->function.block.obj.capacity;
+    if ((heapFrame = allocFrame(ejs, capacity)) == 0) {
+        return 0;
+    }
+    var = heapFrame->function.block.obj.var;
+    memcpy(heapFrame, frame, sizeof(EjsFrame));
+    heapFrame->function.block.obj.var = var;
+
+    if (frame->function.block.obj.var.separateSlots) {
+        heapFrame->function.block.obj.var.separateSlots = 1;
+    } else {
+        heapFrame->function.block.obj.slots = (EjsVar**) &(((char*) heapFrame)[sizeof(EjsFrame)]);
+        memcpy(heapFrame->function.block.obj.slots, frame->function.block.obj.slots, capacity * sizeof(EjsVar*));
+    }
+    while ((child = mprGetFirstChild(frame)) != 0) {
+        mprStealBlock(heapFrame, MPR_GET_PTR(child));
+    }
+    ejsSetDebugName(heapFrame, ejsGetDebugName(frame));
+
+    for (block = state->bp; block && block != (EjsBlock*) frame; block = block->prev) {
+        if (block->prev == (EjsBlock*) frame) {
+            block->prev = (EjsBlock*) heapFrame;
+        }
+        if (block->scopeChain == (EjsBlock*) frame) {
+            block->scopeChain = (EjsBlock*) heapFrame;
+        }
+    }
+    if (state->bp == (EjsBlock*) frame) {
+        state->bp = (EjsBlock*) heapFrame;
+    }
+    state->fp = heapFrame;
+    return heapFrame;
+}
+
+
 void ejsCreateFunctionType(Ejs *ejs)
 {
     EjsType     *type;
@@ -104,7 +104,7 @@ static EjsVar *error(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
     for (i = 0; i < count; i++) {
         if ((vp = ejsGetProperty(ejs, args, i)) != 0) {
             if (!ejsIsString(vp)) {
-                vp = ejsSerialize(ejs, vp, -1, 0, 0);
+                vp = ejsSerialize(ejs, vp, -1, 0);
             }
             if (ejs->exception) {
                 return 0;
@@ -10,17 +10,45 @@
 
 /*********************************** Locals ***********************************/
 
+typedef struct JsonMember {
+    EjsName     qname;                  /* Member name. Unused for array elements */
+    EjsVar      *value;                 /* Parsed value */
+} JsonMember;
+
 typedef struct JsonState {
-    char    *data;
-    char    *end;
-    char    *next;
-    char    *error;
+    cchar       *data;                  /* Start of the input text */
+    cchar       *end;                   /* End of the input text */
+    cchar       *next;                  /* Next character to parse */
+    cchar       *error;                 /* Location of a parse error */
+    MprBuf      *buf;                   /* Scratch buffer for strings with escapes and long tokens */
+    MprCtx      names;                  /* Owner of member names until they are given to an object */
+    JsonMember  *stack;                 /* Members of containers that are still being parsed */
+    int         top;                    /* Next free stack entry */
+    int         size;                   /* Allocated stack entries */
 } JsonState;
 
+typedef struct JsonEncoder {
+    MprBuf      *buf;                   /* Single output buffer shared by all nesting levels */
+    EjsFunction *objectToJson;          /* Object.toJSON. Types using it are encoded inline */
+    int         depth;
+    int         maxDepth;
+    int         flags;
+} JsonEncoder;
+
+/*
+ *  Characters permitted in unquoted names and values
+ */
+#define isTokenChar(c) (isalnum((int) (c)) || (c) == '_' || (c) == '$' || (c) == '-' || (c) == '+' || (c) == '.' || \
+    (c) == ' ')
+
 /***************************** Forward Declarations ***************************/
 
-static EjsVar *parseLiteral(Ejs *ejs, JsonState *js);
-static EjsVar *parseLiteralInner(Ejs *ejs, MprBuf *buf, JsonState *js);
+static int encodeVar(Ejs *ejs, JsonEncoder *je, EjsVar *vp);
+
+static EjsVar *parseJson(Ejs *ejs, cchar *data, int len, EjsVar **key);
+static int parseMember(Ejs *ejs, JsonState *js, EjsName *qname, EjsVar **vpp);
+static EjsVar *parseValue(Ejs *ejs, JsonState *js);
+static void skipSpace(JsonState *js);
 
 /*********************************** Locals ***********************************/
 /*
@@ -37,8 +65,6 @@ EjsVar *deserialize(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
 
 EjsVar *ejsDeserialize(Ejs *ejs, EjsString *str)
 {
-    EjsVar      *obj;
-    JsonState   js;
     char        *data;
 
     if (!ejsIsString(str)) {
@@ -50,303 +76,639 @@ EjsVar *ejsDeserialize(Ejs *ejs, EjsString *str)
     } else if (*data == '\0') {
         return (EjsVar*) ejs->emptyStringValue;
     }
-
-    js.next = js.data = data;
-    js.end = &js.data[str->length];
-    js.error = 0;
-    if ((obj = parseLiteral(ejs, &js)) == 0) {
-        if (js.error) {
-            ejsThrowSyntaxError(ejs, 
-                "Can't parse object literal. Error at position %d.\n"
-                "===========================\n"
-                "Offending text: %s\n"
-                "===========================\n"
-                "In literal %s"
-                "\n===========================\n",
-                (int) (js.error - js.data), js.error, js.data);
-        } else {
-            ejsThrowSyntaxError(ejs, "Can't parse object literal. Undefined error");
-        }
-        return 0;
-    }
-    return obj;
+    return parseJson(ejs, data, str->length, NULL);
 }
 
 
-static EjsVar *parseLiteral(Ejs *ejs, JsonState *js)
+/*
+ *  Parse a complete JSON value. If key is supplied, the text is an object member ("name: value") and the member name 
+ *  is returned via *key.
+ */
+static EjsVar *parseJson(Ejs *ejs, cchar *data, int len, EjsVar **key)
 {
-    MprBuf      *buf;
+    JsonState   js;
     EjsVar      *vp;
+    EjsName     qname;
 
-    mprAssert(js);
-
-    buf = mprCreateBuf(ejs, 0, 0);
-    vp = parseLiteralInner(ejs, buf, js);
-    mprFree(buf);
+    memset(&js, 0, sizeof(js));
+    js.next = js.data = data;
+    js.end = &data[len];
+    js.buf = mprCreateBuf(ejs, 0, 0);
+    js.names = mprAlloc(ejs, 1);
+    if (js.buf == 0 || js.names == 0) {
+        mprFree(js.buf);
+        mprFree(js.names);
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    if (key) {
+        vp = 0;
+        if (parseMember(ejs, &js, &qname, &vp) == 0) {
+            *key = (EjsVar*) ejsCreateString(ejs, qname.name);
+        }
+    } else {
+        vp = parseValue(ejs, &js);
+    }
+    if (vp) {
+        skipSpace(&js);
+        if (js.next < js.end) {
+            js.error = js.next;
+            vp = 0;
+        }
+    }
+    if (vp == 0 && !ejs->exception) {
+        if (js.error == 0) {
+            js.error = js.next;
+        }
+        ejsThrowSyntaxError(ejs, 
+            "Can't parse object literal. Error at position %d.\n"
+            "===========================\n"
+            "Offending text: %.*s\n"
+            "===========================\n",
+            (int) (js.error - js.data), (int) min((int) (js.end - js.error), EJS_JSON_MAX_ERROR_TEXT), js.error);
+    }
+    mprFree(js.stack);
+    mprFree(js.names);
+    mprFree(js.buf);
     return vp;
 }
 
 
-typedef enum Token {
-    TOK_ERR,            /* Error */
-    TOK_EOF,            /* End of input */
-    TOK_LBRACE,         /* { */
-    TOK_LBRACKET,       /* [ */
-    TOK_RBRACE,         /* } */
-    TOK_RBRACKET,       /* ] */
-    TOK_COLON,          /* : */
-    TOK_COMMA,          /* , */
-    TOK_ID,             /* Unquoted ID */
-    TOK_QID,            /* Quoted ID */
-} Token;
-
-
-Token getNextJsonToken(MprBuf *buf, char **token, JsonState *js)
+static void skipSpace(JsonState *js)
 {
-    uchar   *start, *cp, *end, *next;
-    char    *src, *dest;
-    int     quote, tid, c;
+    while (js->next < js->end && isspace((int) *js->next)) {
+        js->next++;
+    }
+}
 
-    next = (uchar*) js->next;
-    end = (uchar*) js->end;
 
-    if (buf) {
-        mprFlushBuf(buf);
+static int pushMember(Ejs *ejs, JsonState *js, EjsName *qname, EjsVar *vp)
+{
+    JsonMember  *mp;
+    int         size;
+
+    if (js->top >= js->size) {
+        size = (js->size) ? (js->size * 2) : EJS_MIN_OBJ_SLOTS;
+        if ((mp = (JsonMember*) mprRealloc(ejs, js->stack, size * (int) sizeof(JsonMember))) == 0) {
+            ejsThrowMemoryError(ejs);
+            return EJS_ERR;
+        }
+        js->stack = mp;
+        js->size = size;
     }
-    for (cp = next; cp < end && isspace((int) *cp); cp++) {
-        ;
+    mp = &js->stack[js->top++];
+    if (qname) {
+        mp->qname = *qname;
     }
-    next = cp + 1;
-
-    if (*cp == '\0') {
-        tid = TOK_EOF;
+    mp->value = vp;
+    return 0;
+}
 
-    } else  if (*cp == '{') {
-        tid = TOK_LBRACE;
 
-    } else if (*cp == '[') {
-        tid = TOK_LBRACKET;
+static void encodeUtf8(MprBuf *buf, int c)
+{
+    if (c < 0x80) {
+        mprPutCharToBuf(buf, c);
+    } else if (c < 0x800) {
+        mprPutCharToBuf(buf, 0xC0 | (c >> 6));
+        mprPutCharToBuf(buf, 0x80 | (c & 0x3F));
+    } else {
+        mprPutCharToBuf(buf, 0xE0 | (c >> 12));
+        mprPutCharToBuf(buf, 0x80 | ((c >> 6) & 0x3F));
+        mprPutCharToBuf(buf, 0x80 | (c & 0x3F));
+    }
+}
 
-    } else if (*cp == '}' || *cp == ']') {
-        tid = *cp == '}' ? TOK_RBRACE: TOK_RBRACKET;
-        while (*++cp && isspace((int) *cp)) ;
-        if (*cp == ',' || *cp == ':') {
-            cp++;
-        }
-        next = cp;
 
-    } else {
-        if (*cp == '"' || *cp == '\'') {
-            tid = TOK_QID;
-            quote = *cp++;
-            for (start = cp; cp < end; cp++) {
-                if (*cp == '\\') {
-                    if (cp[1] == quote) {
-                        cp++;
-                    }
-                    continue;
-                }
-                if (*cp == quote) {
-                    break;
-                }
-            }
-        } else {
-            quote = -1;
-            tid = TOK_ID;
-            for (start = cp; cp < end; cp++) {
-                if (*cp == '\\') {
-                    continue;
-                }
-                /* Not an allowable character outside quotes */
-                if (!(isalnum((int) *cp) || *cp == '_' || *cp == ' ' || *cp == '-' || *cp == '+' || *cp == '.')) {
-                    break;
-                }
-            }
-        }
-        if (buf) {
-            mprPutBlockToBuf(buf, (char*) start, (int) (cp - start));
-            mprAddNullToBuf(buf);
-        }
-        if (quote > 0) {
-            if (*cp == quote) {
-                cp++;
-            } else {
-                js->error = (char*) cp;
-                return TOK_ERR;
+/*
+ *  Scan a quoted string and return its text. Strings without escapes are returned in place. Otherwise the decoded 
+ *  text is returned from the scratch buffer which is valid until the next scan.
+ */
+static cchar *scanString(JsonState *js, int *lenp)
+{
+    MprBuf      *buf;
+    cchar       *start, *cp;
+    int         quote, escapes, c, i;
+
+    quote = *js->next++;
+    escapes = 0;
+    for (cp = start = js->next; cp < js->end && *cp != quote; cp++) {
+        if (*cp == '\\') {
+            escapes++;
+            if (++cp >= js->end) {
+                break;
             }
         }
-        if (*cp == ',' || *cp == ':') {
-            cp++;
-        } else if (*cp != '}' && *cp != ']' && *cp != '\0' && *cp != '\n' && *cp != '\r' && *cp != ' ') {
-            js->error = (char*) cp;
-            return TOK_ERR;
+    }
+    if (cp >= js->end) {
+        js->error = start - 1;
+        return 0;
+    }
+    js->next = cp + 1;
+    if (escapes == 0) {
+        *lenp = (int) (cp - start);
+        return start;
+    }
+    buf = js->buf;
+    mprFlushBuf(buf);
+    for (cp = start; *cp != quote; cp++) {
+        if (*cp != '\\') {
+            mprPutCharToBuf(buf, *cp);
+            continue;
         }
-        next = cp;
-
-        if (buf) {
-            for (dest = src = buf->start; src < buf->end; ) {
-                c = *src++;
-                if (c == '\\') {
-                    c = *src++;
-                    if (c == 'r') {
-                        c = '\r';
-                    } else if (c == 'n') {
-                        c = '\n';
-                    } else if (c == 'b') {
-                        c = '\b';
-                    }
-                }
-                *dest++ = c;
+        switch (c = *++cp) {
+        case 'b': c = '\b'; break;
+        case 'f': c = '\f'; break;
+        case 'n': c = '\n'; break;
+        case 'r': c = '\r'; break;
+        case 't': c = '\t'; break;
+        case 'u':
+            for (c = 0, i = 0; i < 4 && cp + 1 < js->next - 1 && isxdigit((int) cp[1]); i++) {
+                c = (c << 4) | (isdigit((int) *++cp) ? (*cp - '0') : (tolower((int) *cp) - 'a' + 10));
             }
-            *dest = '\0';
-            *token = mprGetBufStart(buf);
+            encodeUtf8(buf, c);
+            continue;
         }
+        mprPutCharToBuf(buf, c);
     }
-    js->next = (char*) next;
-    return tid;
+    mprAddNullToBuf(buf);
+    *lenp = mprGetBufLength(buf);
+    return mprGetBufStart(buf);
 }
 
 
-Token peekNextJsonToken(JsonState *js)
+/*
+ *  Scan an unquoted name or value. Trailing spaces are not part of the token.
+ */
+static cchar *scanToken(JsonState *js, int *lenp)
 {
-    JsonState   discard = *js;
-    return getNextJsonToken(NULL, NULL, &discard);
+    cchar   *start, *cp;
+
+    for (cp = start = js->next; cp < js->end && isTokenChar(*cp); cp++) ;
+    js->next = cp;
+    while (cp > start && cp[-1] == ' ') {
+        cp--;
+    }
+    if (cp == start) {
+        js->error = start;
+        return 0;
+    }
+    *lenp = (int) (cp - start);
+    return start;
 }
 
 
 /*
- *  Parse an object literal string pointed to by js->next into the given buffer. Update js->next to point
- *  to the next input token in the object literal. Supports nested object literals.
+ *  Parse a member name. The name is allocated from js->names until the object that owns it is created.
  */
-static EjsVar *parseLiteralInner(Ejs *ejs, MprBuf *buf, JsonState *js)
+static char *parseName(Ejs *ejs, JsonState *js)
 {
-    EjsName     qname;
-    EjsVar      *obj, *vp;
-    MprBuf      *valueBuf;
-    char        *token, *key, *value;
-    int         tid, isArray;
-
-    isArray = 0;
+    cchar   *str;
+    char    *name;
+    int     len;
 
-    tid = getNextJsonToken(buf, &token, js);
-    if (tid == TOK_ERR || tid == TOK_EOF) {
+    skipSpace(js);
+    if (js->next >= js->end) {
+        js->error = js->next;
         return 0;
     }
-    if (tid == TOK_LBRACKET) {
-        isArray = 1;
-        obj = (EjsVar*) ejsCreateArray(ejs, 0);
-    } else if (tid == TOK_LBRACE) {
-        obj = (EjsVar*) ejsCreateObject(ejs, ejs->objectType, 0);
-    } else {
-        return ejsParseVar(ejs, token, ES_String);
+    str = (*js->next == '"' || *js->next == '\'') ? scanString(js, &len) : scanToken(js, &len);
+    if (str == 0) {
+        return 0;
+    }
+    if ((name = (char*) mprAlloc(js->names, len + 1)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    memcpy(name, str, len);
+    name[len] = '\0';
+    return name;
+}
+
+
+/*
+ *  Parse an object member of the form: name: value. Names may be namespace qualified as "space"::"name". The space
+ *  is null for unqualified names.
+ */
+static int parseMember(Ejs *ejs, JsonState *js, EjsName *qname, EjsVar **vpp)
+{
+    char    *name;
+
+    if ((name = parseName(ejs, js)) == 0) {
+        return EJS_ERR;
     }
-    if (obj == 0) {
+    qname->space = 0;
+    qname->name = name;
+    skipSpace(js);
+    if ((js->end - js->next) >= 2 && js->next[0] == ':' && js->next[1] == ':') {
+        js->next += 2;
+        qname->space = name;
+        if ((qname->name = parseName(ejs, js)) == 0) {
+            return EJS_ERR;
+        }
+        skipSpace(js);
+    }
+    if (js->next >= js->end || *js->next != ':') {
+        js->error = js->next;
+        return EJS_ERR;
+    }
+    js->next++;
+    if ((*vpp = parseValue(ejs, js)) == 0) {
+        return EJS_ERR;
+    }
+    return 0;
+}
+
+
+/*
+ *  Create an object from the members on the stack above base. The object is sized for all members before the 
+ *  properties are defined. Names are only interned if the object shares a shape. Otherwise the object takes 
+ *  ownership of the names.
+ */
+static EjsVar *createObject(Ejs *ejs, JsonState *js, int base)
+{
+    EjsObject   *obj;
+    JsonMember  *mp;
+    int         count;
+
+    count = js->top - base;
+    if ((obj = ejsCreateObject(ejs, ejs->objectType, 0)) == 0 || ejsReserveObjectSlots(ejs, obj, count) < 0) {
         ejsThrowMemoryError(ejs);
         return 0;
     }
+    for (mp = &js->stack[base]; mp < &js->stack[js->top]; mp++) {
+        if (ejsSetPropertyByAllocatedName(ejs, obj, (char*) mp->qname.space, (char*) mp->qname.name, mp->value) < 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+    }
+    js->top = base;
+    return (EjsVar*) obj;
+}
 
+
+static EjsVar *parseObject(Ejs *ejs, JsonState *js)
+{
+    EjsName     qname;
+    EjsVar      *vp;
+    int         base;
+
+    js->next++;
+    base = js->top;
     while (1) {
-        vp = 0;
-        tid = peekNextJsonToken(js);
-        if (tid == TOK_ERR) {
+        skipSpace(js);
+        if (js->next >= js->end) {
+            js->error = js->next;
             return 0;
-        } else if (tid == TOK_EOF) {
-            break;
-        } else if (tid == TOK_RBRACE || tid == TOK_RBRACKET) {
-            getNextJsonToken(buf, &key, js);
+        } else if (*js->next == '}') {
+            js->next++;
             break;
+        } else if (*js->next == ',') {
+            js->next++;
+            continue;
         }
-        if (tid == TOK_LBRACKET) {
-            /* For array values */
-            vp = parseLiteral(ejs, js);
-            mprAssert(vp);
-            
-        } else if (tid == TOK_LBRACE) {
-            /* For object values */
-            vp = parseLiteral(ejs, js);
-            mprAssert(vp);
-            
-        } else if (isArray) {
-            tid = getNextJsonToken(buf, &value, js);
-            vp = ejsParseVar(ejs, value, (tid == TOK_QID) ? ES_String : -1);
-            mprAssert(vp);
-            
-        } else {
-            getNextJsonToken(buf, &key, js);
-            tid = peekNextJsonToken(js);
-            if (tid == TOK_ERR) {
-                mprAssert(0);
-                return 0;
-            } else if (tid == TOK_EOF) {
-                break;
-            } else if (tid == TOK_LBRACE || tid == TOK_LBRACKET) {
-                vp = parseLiteral(ejs, js);
-                mprAssert(vp);
-
-            } else if (tid == TOK_ID || tid == TOK_QID) {
-                valueBuf = mprCreateBuf(ejs, 0, 0);
-                getNextJsonToken(valueBuf, &value, js);
-                if (tid == TOK_QID) {
-                    vp = (EjsVar*) ejsCreateString(ejs, value);
-                } else {
-                    if (strcmp(value, "null") == 0) {
-                        vp = ejs->nullValue;
-                    } else if (strcmp(value, "undefined") == 0) {
-                        vp = ejs->undefinedValue;
-                    } else {
-                        vp = ejsParseVar(ejs, value, -1);
-                    }
-                }
-                mprAssert(vp);
-                mprFree(valueBuf);
-            } else {
-                getNextJsonToken(buf, &value, js);
-                mprAssert(0);
-                js->error = js->next;
-                return 0;
-            }
+        if (parseMember(ejs, js, &qname, &vp) < 0 || pushMember(ejs, js, &qname, vp) < 0) {
+            return 0;
         }
-        if (vp == 0) {
+    }
+    return createObject(ejs, js, base);
+}
+
+
+static EjsVar *parseArray(Ejs *ejs, JsonState *js)
+{
+    EjsArray    *ap;
+    EjsVar      *vp;
+    int         base, i;
+
+    js->next++;
+    base = js->top;
+    while (1) {
+        skipSpace(js);
+        if (js->next >= js->end) {
             js->error = js->next;
             return 0;
+        } else if (*js->next == ']') {
+            js->next++;
+            break;
+        } else if (*js->next == ',') {
+            js->next++;
+            continue;
+        }
+        if ((vp = parseValue(ejs, js)) == 0 || pushMember(ejs, js, NULL, vp) < 0) {
+            return 0;
+        }
+    }
+    if ((ap = ejsCreateArray(ejs, js->top - base)) == 0) {
+        return 0;
+    }
+    for (i = base; i < js->top; i++) {
+        ejsSetProperty(ejs, (EjsVar*) ap, i - base, js->stack[i].value);
+    }
+    js->top = base;
+    return (EjsVar*) ap;
+}
+
+
+/*
+ *  Parse an unquoted value: null, undefined, true, false, a number or an unquoted string
+ */
+static EjsVar *parseToken(Ejs *ejs, JsonState *js)
+{
+    cchar   *str;
+    char    token[64];
+    int     len;
+
+    if ((str = scanToken(js, &len)) == 0) {
+        return 0;
+    }
+    switch (*str) {
+    case 'n':
+        if (len == 4 && strncmp(str, "null", 4) == 0) {
+            return ejs->nullValue;
+        }
+        break;
+    case 'u':
+        if (len == 9 && strncmp(str, "undefined", 9) == 0) {
+            return ejs->undefinedValue;
+        }
+        break;
+    case 't':
+        if (len == 4 && strncmp(str, "true", 4) == 0) {
+            return (EjsVar*) ejs->trueValue;
+        }
+        break;
+    case 'f':
+        if (len == 5 && strncmp(str, "false", 5) == 0) {
+            return (EjsVar*) ejs->falseValue;
         }
-        if (isArray) {
-            if (ejsSetProperty(ejs, obj, -1, vp) < 0) {
-                ejsThrowMemoryError(ejs);
-                return 0;
+        break;
+    }
+    if (len < (int) sizeof(token)) {
+        memcpy(token, str, len);
+        token[len] = '\0';
+        return ejsParseVar(ejs, token, -1);
+    }
+    mprFlushBuf(js->buf);
+    mprPutBlockToBuf(js->buf, str, len);
+    mprAddNullToBuf(js->buf);
+    return ejsParseVar(ejs, mprGetBufStart(js->buf), -1);
+}
+
+
+/*
+ *  Parse a value directly from the input text
+ */
+static EjsVar *parseValue(Ejs *ejs, JsonState *js)
+{
+    cchar   *str;
+    int     len;
+
+    skipSpace(js);
+    if (js->next >= js->end) {
+        js->error = js->next;
+        return 0;
+    }
+    switch (*js->next) {
+    case '{':
+        return parseObject(ejs, js);
+    case '[':
+        return parseArray(ejs, js);
+    case '"':
+    case '\'':
+        if ((str = scanString(js, &len)) == 0) {
+            return 0;
+        }
+        return (EjsVar*) ejsCreateStringWithLength(ejs, str, len);
+    default:
+        return parseToken(ejs, js);
+    }
+}
+
+
+/*
+ *  Serialize a string with quotes and escapes directly into the output buffer
+ */
+static void encodeString(JsonEncoder *je, cchar *str, int len)
+{
+    MprBuf  *buf;
+    cchar   *cp, *end, *start;
+
+    buf = je->buf;
+    mprPutCharToBuf(buf, '"');
+    for (start = cp = str, end = &str[len]; cp < end; cp++) {
+        if (*cp == '"' || *cp == '\\') {
+            mprPutBlockToBuf(buf, start, (int) (cp - start));
+            mprPutCharToBuf(buf, '\\');
+            start = cp;
+        }
+    }
+    mprPutBlockToBuf(buf, start, (int) (cp - start));
+    mprPutCharToBuf(buf, '"');
+}
+
+
+static void encodeNumber(Ejs *ejs, JsonEncoder *je, EjsNumber *np)
+{
+#if BLD_FEATURE_NUM_TYPE_DOUBLE
+    char    *str;
+
+    str = mprDtoa(je->buf, np->value, 0, 0, 0);
+    mprPutStringToBuf(je->buf, str);
+    mprFree(str);
+#elif MPR_64_BIT
+    char    numBuf[32];
+
+    mprSprintf(numBuf, sizeof(numBuf), "%Ld", np->value);
+    mprPutStringToBuf(je->buf, numBuf);
+#else
+    char    numBuf[32];
+
+    mprItoa(numBuf, sizeof(numBuf), (int) np->value, 10);
+    mprPutStringToBuf(je->buf, numBuf);
+#endif
+}
+
+
+static void indent(JsonEncoder *je, int depth)
+{
+    while (depth-- > 0) {
+        mprPutStringToBuf(je->buf, "  ");
+    }
+}
+
+
+/*
+ *  Serialize the properties of an object or array. Nested values are written into the same buffer.
+ */
+static int encodeObject(Ejs *ejs, JsonEncoder *je, EjsVar *vp)
+{
+    EjsVar      *pp;
+    EjsName     qname;
+    EjsString   *sv;
+    int         isArray, count, slotNum, numInherited, pretty, emitted;
+
+    count = ejsGetPropertyCount(ejs, vp);
+    if (count == 0 && vp->type != ejs->objectType && vp->type != ejs->arrayType) {
+        if ((sv = ejsToString(ejs, vp)) == 0) {
+            return EJS_ERR;
+        }
+        mprPutBlockToBuf(je->buf, sv->value, sv->length);
+        return 0;
+    }
+    isArray = ejsIsArray(vp);
+    pretty = je->flags & EJS_FLAGS_PRETTY;
+    numInherited = (ejsIsBlock(vp) && !(je->flags & EJS_FLAGS_ENUM_INHERITED)) ? 
+        ejsGetNumInheritedTraits((EjsBlock*) vp) : 0;
+    emitted = 0;
+
+    vp->jsonVisited = 1;
+    mprPutCharToBuf(je->buf, isArray ? '[' : '{');
+    if (pretty) {
+        mprPutCharToBuf(je->buf, '\n');
+    }
+    if (++je->depth <= je->maxDepth) {
+        for (slotNum = numInherited; slotNum < count; slotNum++) {
+            pp = ejsGetProperty(ejs, vp, slotNum);
+            if (ejs->exception) {
+                vp->jsonVisited = 0;
+                return EJS_ERR;
+            }
+            if (pp == 0 || (pp->hidden && !(je->flags & EJS_FLAGS_ENUM_ALL))) {
+                continue;
+            }
+            if (ejsIsFunction(pp) && !(je->flags & EJS_FLAGS_ENUM_ALL)) {
+                continue;
+            }
+            if (!isArray) {
+                qname = ejsGetPropertyName(ejs, vp, slotNum);
+                if (qname.space && strstr(qname.space, ",private") != 0) {
+                    continue;
+                }
+                if (qname.space[0] == '\0' && qname.name[0] == '\0') {
+                    continue;
+                }
+            }
+            if (emitted++ > 0) {
+                mprPutStringToBuf(je->buf, pretty ? ",\n" : ",");
+            }
+            if (pretty) {
+                indent(je, je->depth);
             }
-        } else {
-            /*
-             *  Must not pool this object otherwise the key allocation will be leak. Need the var to be freed.
-             */
-            key = mprStrdup(obj, key);
-            ejsName(&qname, EJS_EMPTY_NAMESPACE, key);
-            obj->noPool = 1;
-            if (ejsSetPropertyByName(ejs, obj, &qname, vp) < 0) {
-                ejsThrowMemoryError(ejs);
-                return 0;
+            if (!isArray) {
+                encodeString(je, qname.name, (int) strlen(qname.name));
+                mprPutStringToBuf(je->buf, pretty ? ": " : ":");
+            }
+            if (encodeVar(ejs, je, pp) < 0) {
+                if (!ejs->exception) {
+                    ejsThrowTypeError(ejs, "Can't serialize property %s", isArray ? "" : qname.name);
+                }
+                vp->jsonVisited = 0;
+                return EJS_ERR;
             }
         }
     }
-    return obj;
+    je->depth--;
+    if (pretty) {
+        if (emitted) {
+            mprPutCharToBuf(je->buf, '\n');
+        }
+        indent(je, je->depth);
+    }
+    mprPutCharToBuf(je->buf, isArray ? ']' : '}');
+    vp->jsonVisited = 0;
+    return 0;
 }
 
 
-EjsVar *ejsSerialize(Ejs *ejs, EjsVar *vp, int maxDepth, bool showAll, bool showBase)
+/*
+ *  Serialize a value. Strings, numbers and plain objects are written directly. Types that override toJSON are 
+ *  invoked and their result appended.
+ */
+static int encodeVar(Ejs *ejs, JsonEncoder *je, EjsVar *vp)
 {
-    int   flags;
+    EjsFunction     *fn;
+    EjsString       *sv;
 
-    if (maxDepth <= 0) {
-        maxDepth = MAXINT;
+    if (vp == 0) {
+        mprPutStringToBuf(je->buf, "undefined");
+        return 0;
     }
-    flags = 0;
-    if (showAll) {
-        flags |= EJS_FLAGS_ENUM_ALL;
+    if (vp->jsonVisited) {
+        mprPutStringToBuf(je->buf, "this");
+        return 0;
     }
-    if (showBase) {
-        flags |= EJS_FLAGS_ENUM_INHERITED;
+    if (ejsIsString(vp)) {
+        encodeString(je, ((EjsString*) vp)->value, ((EjsString*) vp)->length);
+        return 0;
+    } else if (ejsIsNumber(vp)) {
+        encodeNumber(ejs, je, (EjsNumber*) vp);
+        return 0;
+    } else if (ejsIsBoolean(vp)) {
+        mprPutStringToBuf(je->buf, ((EjsBoolean*) vp)->value ? "true" : "false");
+        return 0;
+    }
+    fn = (EjsFunction*) ejsGetProperty(ejs, (EjsVar*) vp->type, ES_Object_toJSON);
+    if (fn == je->objectToJson) {
+        return encodeObject(ejs, je, vp);
+    }
+    vp->jsonVisited = 1;
+    if (ejsIsFunction(fn)) {
+        sv = (EjsString*) ejsRunFunction(ejs, fn, vp, 0, NULL);
+    } else {
+        sv = ejsToString(ejs, vp);
     }
-    return (EjsVar*) ejsToJson(ejs, vp); 
+    vp->jsonVisited = 0;
+    if (sv == 0 || !ejsIsString(sv)) {
+        return EJS_ERR;
+    }
+    mprPutBlockToBuf(je->buf, sv->value, sv->length);
+    return 0;
+}
+
+
+static EjsVar *serializeWith(Ejs *ejs, EjsVar *vp, int maxDepth, int flags, int object)
+{
+    JsonEncoder     je;
+    EjsString       *result;
+    int             rc;
+
+    je.buf = mprCreateBuf(ejs, EJS_JSON_BUF_SIZE, 0);
+    je.depth = 0;
+    je.maxDepth = (maxDepth <= 0) ? MAXINT : maxDepth;
+    je.flags = flags;
+    je.objectToJson = (EjsFunction*) ejsGetProperty(ejs, (EjsVar*) ejs->objectType, ES_Object_toJSON);
+
+    rc = (object) ? encodeObject(ejs, &je, vp) : encodeVar(ejs, &je, vp);
+    if (rc < 0 || ejs->exception) {
+        if (!ejs->exception) {
+            ejsThrowTypeError(ejs, "Can't serialize object");
+        }
+        mprFree(je.buf);
+        return 0;
+    }
+    mprAddNullToBuf(je.buf);
+    result = ejsCreateStringAndFree(ejs, mprStealBuf(ejs, je.buf));
+    mprFree(je.buf);
+    return (EjsVar*) result;
+}
+
+
+/*
+ *  Serialize a value into a single output buffer. Output is compact unless EJS_FLAGS_PRETTY is specified.
+ */
+EjsVar *ejsSerialize(Ejs *ejs, EjsVar *vp, int maxDepth, int flags)
+{
+    return serializeWith(ejs, vp, maxDepth, flags, 0);
+}
+
+
+/*
+ *  Serialize the properties of an object ignoring any toJSON override defined by its type
+ */
+EjsVar *ejsSerializeObject(Ejs *ejs, EjsVar *vp, int maxDepth, int flags)
+{
+    return serializeWith(ejs, vp, maxDepth, flags, 1);
 }
 
 
@@ -354,27 +716,246 @@ EjsVar *ejsSerialize(Ejs *ejs, EjsVar *vp, int maxDepth, bool showAll, bool show
  *  Convert the object to a source code string.
  *
  *  intrinsic function serialize(obj: Object, maxDepth: Number = 0, showAll: Boolean = false, 
- *      showBase: Boolean = false): String
+ *      showBase: Boolean = false, pretty: Boolean = false): String
  */
 static EjsVar *serialize(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
 {
-    int     maxDepth;
-    bool    showBase, showAll;
+    int     maxDepth, flags;
 
     maxDepth = MAXINT;
+    flags = 0;
 
     if (argc >= 2) {
         maxDepth = ejsGetInt(argv[1]);
     }
-    showAll = (argc >= 3 && argv[2] == (EjsVar*) ejs->trueValue);
-    showBase = (argc == 4 && argv[3] == (EjsVar*) ejs->trueValue);
-    return ejsSerialize(ejs, argv[0], maxDepth, showAll, showBase);
+    if (argc >= 3 && argv[2] == (EjsVar*) ejs->trueValue) {
+        flags |= EJS_FLAGS_ENUM_ALL;
+    }
+    if (argc >= 4 && argv[3] == (EjsVar*) ejs->trueValue) {
+        flags |= EJS_FLAGS_ENUM_INHERITED;
+    }
+    if (argc >= 5 && argv[4] == (EjsVar*) ejs->trueValue) {
+        flags |= EJS_FLAGS_PRETTY;
+    }
+    return ejsSerialize(ejs, argv[0], maxDepth, flags);
 }
 
 
+/********************************* JSONParser *********************************/
+#if ES_JSONParser
+/*
+ *  Create an incremental parser
+ *
+ *  function JSONParser(callback: Function, depth: Number = 1)
+ */
+static EjsVar *parserConstructor(Ejs *ejs, EjsJSONParser *jp, int argc, EjsVar **argv)
+{
+    mprAssert(argc == 1 || argc == 2);
+
+    if (!ejsIsFunction(argv[0])) {
+        ejsThrowArgError(ejs, "Callback must be a function");
+        return 0;
+    }
+    jp->callback = (EjsFunction*) argv[0];
+    jp->depth = (argc == 2) ? ejsGetInt(argv[1]) : 1;
+    if (jp->depth < 0) {
+        ejsThrowArgError(ejs, "Bad depth");
+        return 0;
+    }
+    if ((jp->input = mprCreateBuf(jp, EJS_JSON_BUF_SIZE, 0)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    jp->start = -1;
+    return 0;
+}
+
+
+/*
+ *  Parse the completed value that ends at the given input offset and pass it to the callback
+ */
+static int emitValue(Ejs *ejs, EjsJSONParser *jp, int end)
+{
+    EjsVar      *argv[2];
+    cchar       *data;
+    int         member;
+
+    data = mprGetBufStart(jp->input) + jp->start;
+    member = (jp->depth > 0 && !jp->isArray);
+    argv[1] = ejs->nullValue;
+    if ((argv[0] = parseJson(ejs, data, end - jp->start, member ? &argv[1] : NULL)) == 0) {
+        return EJS_ERR;
+    }
+    if (jp->depth > 0 && jp->isArray) {
+        argv[1] = (EjsVar*) ejsCreateNumber(ejs, jp->index++);
+    }
+    jp->start = -1;
+    ejsRunFunction(ejs, jp->callback, NULL, 2, argv);
+    return (ejs->exception) ? EJS_ERR : 0;
+}
+
+
+/*
+ *  Scan new input for values that are complete at the emit depth. Scanning only tracks strings and container 
+ *  nesting. Values are parsed once complete. Only the text of a pending value is retained between writes.
+ */
+static int scanInput(Ejs *ejs, EjsJSONParser *jp)
+{
+    MprBuf      *buf;
+    cchar       *data;
+    int         pos, len, c, discard;
+
+    buf = jp->input;
+    data = mprGetBufStart(buf);
+    len = mprGetBufLength(buf);
+
+    for (pos = jp->scan; pos < len; pos++) {
+        c = data[pos];
+        if (jp->quote) {
+            if (jp->escape) {
+                jp->escape = 0;
+            } else if (c == '\\') {
+                jp->escape = 1;
+            } else if (c == jp->quote) {
+                jp->quote = 0;
+            }
+            continue;
+        }
+        switch (c) {
+        case '"':
+        case '\'':
+            jp->quote = c;
+            break;
+
+        case '{':
+        case '[':
+            if (jp->level == jp->depth && jp->start < 0) {
+                jp->start = pos;
+            }
+            if (++jp->level == jp->depth) {
+                jp->isArray = (c == '[');
+                jp->index = 0;
+            }
+            continue;
+
+        case '}':
+        case ']':
+            if (jp->level == jp->depth && jp->start >= 0 && emitValue(ejs, jp, pos) < 0) {
+                return EJS_ERR;
+            }
+            if (--jp->level < 0) {
+                ejsThrowSyntaxError(ejs, "Unexpected \"%c\" in JSON input", c);
+                return EJS_ERR;
+            }
+            if (jp->level == 0 && jp->depth == 0 && jp->start >= 0 && emitValue(ejs, jp, pos + 1) < 0) {
+                return EJS_ERR;
+            }
+            continue;
+
+        case ',':
+            if (jp->level == jp->depth && jp->start >= 0 && jp->depth > 0 && emitValue(ejs, jp, pos) < 0) {
+                return EJS_ERR;
+            }
+            continue;
+
+        case ':':
+            continue;
+        }
+        if (jp->level == jp->depth && jp->start < 0 && !isspace(c)) {
+            jp->start = pos;
+        }
+    }
+    discard = (jp->start >= 0) ? jp->start : pos;
+    mprAdjustBufStart(buf, discard);
+    mprCompactBuf(buf);
+    jp->scan = pos - discard;
+    if (jp->start >= 0) {
+        jp->start -= discard;
+    }
+    return 0;
+}
+
+
+/*
+ *  Write the next chunk of JSON text
+ *
+ *  function write(data: Object): Void
+ */
+static EjsVar *parserWrite(Ejs *ejs, EjsJSONParser *jp, int argc, EjsVar **argv)
+{
+    EjsByteArray    *ap;
+    EjsString       *sp;
+
+    mprAssert(argc == 1);
+
+    if (jp->input == 0 || jp->busy) {
+        ejsThrowStateError(ejs, "Parser is not ready for writing");
+        return 0;
+    }
+    if (ejsIsString(argv[0])) {
+        sp = (EjsString*) argv[0];
+        mprPutBlockToBuf(jp->input, sp->value, sp->length);
+
+    } else if (ejsIsByteArray(argv[0])) {
+        ap = (EjsByteArray*) argv[0];
+        mprPutBlockToBuf(jp->input, (char*) &ap->value[ap->readPosition], ap->writePosition - ap->readPosition);
+        ejsSetByteArrayPositions(ejs, ap, ap->writePosition, -1);
+
+    } else {
+        ejsThrowArgError(ejs, "Data must be a String or ByteArray");
+        return 0;
+    }
+    jp->busy = 1;
+    scanInput(ejs, jp);
+    jp->busy = 0;
+    return 0;
+}
+
+
+/*
+ *  Signal the end of input
+ *
+ *  function end(): Void
+ */
+static EjsVar *parserEnd(Ejs *ejs, EjsJSONParser *jp, int argc, EjsVar **argv)
+{
+    if (jp->input == 0 || jp->busy) {
+        ejsThrowStateError(ejs, "Parser is not ready for writing");
+        return 0;
+    }
+    if (jp->level > 0 || jp->quote) {
+        ejsThrowSyntaxError(ejs, "Incomplete JSON input");
+        return 0;
+    }
+    if (jp->start >= 0) {
+        jp->busy = 1;
+        emitValue(ejs, jp, mprGetBufLength(jp->input));
+        jp->busy = 0;
+    }
+    mprFlushBuf(jp->input);
+    jp->scan = 0;
+    jp->start = -1;
+    return 0;
+}
+
+
+static void markJSONParser(Ejs *ejs, EjsVar *parent, EjsJSONParser *jp)
+{
+    ejsMarkObject(ejs, parent, (EjsObject*) jp);
+    if (jp->callback) {
+        ejsMarkVar(ejs, (EjsVar*) jp, (EjsVar*) jp->callback);
+    }
+}
+#endif /* ES_JSONParser */
+
+/*********************************** Factory **********************************/
+
 void ejsConfigureJSON(Ejs *ejs)
 {
     EjsBlock    *block;
+#if ES_JSONParser
+    EjsType     *type;
+#endif
 
     block = ejs->globalBlock;
     mprAssert(block);
@@ -385,6 +966,17 @@ void ejsConfigureJSON(Ejs *ejs)
 #if ES_serialize
     ejsBindFunction(ejs, block, ES_serialize, serialize);
 #endif
+#if ES_JSONParser
+    type = (EjsType*) ejsGetProperty(ejs, ejs->global, ES_JSONParser);
+    if (type) {
+        type->instanceSize = sizeof(EjsJSONParser);
+        type->dontPool = 1;
+        type->helpers->markVar = (EjsMarkVarHelper) markJSONParser;
+        ejsBindMethod(ejs, type, ES_JSONParser_JSONParser, (EjsNativeFunction) parserConstructor);
+        ejsBindMethod(ejs, type, ES_JSONParser_write, (EjsNativeFunction) parserWrite);
+        ejsBindMethod(ejs, type, ES_JSONParser_end, (EjsNativeFunction) parserEnd);
+    }
+#endif
 }
 
 
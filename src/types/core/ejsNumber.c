@@ -448,19 +448,21 @@ bool ejsIsInfinite(MprNumber f)
 
 /*********************************** Factory **********************************/
 /*
-    Create an initialized number
+    Create an initialized number. Small integral values are returned from the preallocated number cache so that
+    loop counters and array indices do not allocate a new object for every operation. Cached values are shared and
+    permanent and must never be modified.
  */
 
 EjsNumber *ejsCreateNumber(Ejs *ejs, MprNumber value)
 {
     EjsNumber   *vp;
+    int         i;
 
-    if (value == 0) {
-        return ejs->zeroValue;
-    } else if (value == 1) {
-        return ejs->oneValue;
-    } else if (value == -1) {
-        return ejs->minusOneValue;
+    if (value >= EJS_MIN_CACHED_NUM && value <= EJS_MAX_CACHED_NUM) {
+        i = (int) value;
+        if (i == value && ejs->numberCache) {
+            return ejs->numberCache[i - EJS_MIN_CACHED_NUM];
+        }
     }
 
     vp = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
@@ -476,7 +478,9 @@ EjsNumber *ejsCreateNumber(Ejs *ejs, MprNumber value)
 void ejsCreateNumberType(Ejs *ejs)
 {
     EjsType     *type;
+    EjsNumber   *np;
     EjsName     qname;
+    int         i, count;
 #if BLD_FEATURE_NUM_TYPE_DOUBLE
     static double zero = 0.0;
 #endif
@@ -491,12 +495,43 @@ void ejsCreateNumberType(Ejs *ejs)
     type->helpers->castVar = (EjsCastVarHelper) castNumber;
     type->helpers->invokeOperator = (EjsInvokeOperatorHelper) invokeNumberOperator;
 
-    ejs->zeroValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
-    ejs->zeroValue->value = 0;
-    ejs->oneValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
-    ejs->oneValue->value = 1;
-    ejs->minusOneValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
-    ejs->minusOneValue->value = -1;
+    /*
+        Preallocate the small integer values. These become permanent via ejsMakeEternalPermanent and are shared by
+        cloned interpreters.
+     */
+    count = EJS_MAX_CACHED_NUM - EJS_MIN_CACHED_NUM + 1;
+    if ((ejs->numberCache = (EjsNumber**) mprAlloc(ejs, count * sizeof(EjsNumber*))) != 0) {
+        for (i = 0; i < count; i++) {
+            if ((np = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0)) == 0) {
+                break;
+            }
+            np->value = (MprNumber) (i + EJS_MIN_CACHED_NUM);
+            np->obj.var.primitive = 1;
+            ejs->numberCache[i] = np;
+        }
+        if (i < count) {
+            /*
+                Release a partial cache and fall back to allocating the common values individually
+             */
+            while (--i >= 0) {
+                ejsFreeVar(ejs, (EjsVar*) ejs->numberCache[i], -1);
+            }
+            mprFree(ejs->numberCache);
+            ejs->numberCache = 0;
+        }
+    }
+    if (ejs->numberCache) {
+        ejs->zeroValue = ejs->numberCache[-EJS_MIN_CACHED_NUM];
+        ejs->oneValue = ejs->numberCache[1 - EJS_MIN_CACHED_NUM];
+        ejs->minusOneValue = ejs->numberCache[-1 - EJS_MIN_CACHED_NUM];
+    } else {
+        ejs->zeroValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
+        ejs->zeroValue->value = 0;
+        ejs->oneValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
+        ejs->oneValue->value = 1;
+        ejs->minusOneValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
+        ejs->minusOneValue->value = -1;
+    }
 
 #if BLD_FEATURE_NUM_TYPE_DOUBLE
     ejs->infinityValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
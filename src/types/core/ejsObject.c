@@ -15,16 +15,18 @@ static int      growSlots(Ejs *ejs, EjsObject *obj, int size);
 static int      hashProperty(EjsObject *obj, int slotNum, EjsName *qname);
 static int      lookupObjectProperty(struct Ejs *ejs, EjsObject *obj, EjsName *qname);
 static int      makeHash(EjsObject *obj);
+static int      setObjectPropertyName(Ejs *ejs, EjsObject *obj, int slotNum, EjsName *qname);
+static int      setShapePropertyName(Ejs *ejs, EjsObject *obj, int slotNum, EjsName *qname);
+static int      unshareNames(EjsObject *obj);
+static void     updateGeneration(Ejs *ejs, EjsObject *obj);
 static inline int cmpQname(EjsName *a, EjsName *b);
 static void     removeHashEntry(EjsObject  *obj, EjsName *qname);
 static EjsVar   *objectToString(Ejs *ejs, EjsVar *vp, int argc, EjsVar **argv);
 
 #define CMP_QNAME(a,b) cmpQname(a, b)
 
-#if KEEP
 static inline int cmpName(EjsName *a, EjsName *b);
 #define CMP_NAME(a,b) cmpName(a, b)
-#endif
 
 /************************************* Code ***********************************/
 /*
@@ -98,28 +100,21 @@ EjsObject *ejsCreateObject(Ejs *ejs, EjsType *type, int numExtraSlots)
         }
     }
 
-    roundSlots = 0;
-    if (type->dontPool || hasNativeType || (obj = (EjsObject*) ejsAllocPooledVar(ejs, type->id)) == 0) {
-        roundSlots = max(numSlots, EJS_MIN_OBJ_SLOTS);
-        if (hasNativeType) {
-            if ((obj = (EjsObject*) ejsAllocVar(ejs, type, 0)) == 0) {
-                return 0;
-            }
-
-        } else {
-            if ((obj = (EjsObject*) ejsAllocVar(ejs, type, roundSlots * (int) sizeof(EjsVar*))) == 0) {
-                return 0;
-            }
-            /*
-             *  Always begin with objects using integrated slots
-             */
-            obj->slots = (EjsVar**) &(((char*) obj)[type->instanceSize]);
-            obj->capacity = roundSlots;
+    if (hasNativeType) {
+        if ((obj = (EjsObject*) ejsAllocVar(ejs, type, 0)) == 0) {
+            return 0;
         }
-#if UNUSED
+
     } else {
-        size = type->instanceSize - (int) sizeof(EjsObject);
-#endif
+        roundSlots = max(numSlots, EJS_MIN_OBJ_SLOTS);
+        if ((obj = (EjsObject*) ejsAllocVar(ejs, type, roundSlots * (int) sizeof(EjsVar*))) == 0) {
+            return 0;
+        }
+        /*
+         *  Always begin with objects using integrated slots
+         */
+        obj->slots = (EjsVar**) &(((char*) obj)[type->instanceSize]);
+        obj->capacity = roundSlots;
     }
     obj->var.type = type;
     obj->var.isObject = 1;
@@ -185,6 +180,13 @@ EjsObject *ejsCopyObject(Ejs *ejs, EjsObject *src, bool deep)
         }
     }
 
+    if (src->names && src->names->shared && dest->names == NULL && dest->var.dynamic) {
+        /*
+         *  Shapes are immutable so the copy can share the names
+         */
+        dest->names = src->names;
+        return dest;
+    }
     if (dest->names == NULL && ejsGrowObjectNames(dest, numProp) < 0) {
         return 0;
     }
@@ -237,11 +239,13 @@ static int deleteObjectProperty(Ejs *ejs, EjsObject *obj, int slotNum)
         return EJS_ERR;
     }
     qname = getObjectPropertyName(ejs, obj, slotNum);
-    if (qname.name == 0) {
+    if (qname.name == 0 || unshareNames(obj) < 0) {
         return EJS_ERR;
     }
     removeHashEntry(obj, &qname);
     obj->slots[slotNum] = ejs->undefinedValue;
+    ejsResetInlineCache(ejs);
+    updateGeneration(ejs, obj);
     return 0;
 }
 
@@ -473,16 +477,13 @@ static int lookupObjectProperty(struct Ejs *ejs, EjsObject *obj, EjsName *qname)
 }
 
 
-#if KEEP
-/****** WARNING - this usurps the native types. Should remove this function or push back into Object */
 /*
- *  Lookup a qualified property name and count the number of name portion matches. This routine is used to quickly lookup a 
- *  qualified name AND determine if there are other names with different namespaces but having the same name portion.
- *  Returns EJS_ERR if more than one matching property is found (ie. two properties of the same name but with different 
- *  namespaces). This should be rare! Otherwise, return the slot number of the unique matching property.
+ *  Lookup a property by the name portion only and ignore the namespace. Return the slot number if exactly one property 
+ *  has the name, EJS_ERR if none have the name and -2 if there are properties of the same name in different 
+ *  namespaces. This should be rare! The hash does not include the namespace, so this takes one hash probe.
  *
- *  This is a special lookup routine for fast varible lookup in the scope chain. Used by ejsLookupVar and ejsLookupScope.
- *  WARNING: updates qname->space
+ *  This is a special lookup routine for fast variable lookup in the scope chain. Used by ejsLookupVarWithNamespaces 
+ *  which then tests if the property namespace is open. Only valid for objects using the standard object helpers.
  */
 int ejsLookupSingleProperty(Ejs *ejs, EjsObject *obj, EjsName *qname)
 {
@@ -492,11 +493,9 @@ int ejsLookupSingleProperty(Ejs *ejs, EjsObject *obj, EjsName *qname)
 
     mprAssert(qname);
     mprAssert(qname->name);
-    mprAssert(qname->space);
-    mprAssert(qname->space[0] == '\0');
 
     names = obj->names;
-    slotNum = -1;
+    slotNum = EJS_ERR;
     count = 0;
 
     if (names) {
@@ -513,13 +512,7 @@ int ejsLookupSingleProperty(Ejs *ejs, EjsObject *obj, EjsName *qname)
             }
 
         } else {
-            /*
-             *  Find the property in the hash chain if it exists. Note the hash does NOT include the namespace portion.
-             *  We assume that names rarely clash with different namespaces. We do this so variable lookup and a single hash 
-             *  probe will find matching names.
-             */
             index = ejsComputeHashCode(names, qname);
-
             for (i = names->buckets[index]; i >= 0;  i = names->entries[i].nextSlot) {
                 propName = &names->entries[i].qname;
                 if (CMP_NAME(propName, qname)) {
@@ -528,18 +521,9 @@ int ejsLookupSingleProperty(Ejs *ejs, EjsObject *obj, EjsName *qname)
                 }
             }
         }
-        if (count == 1) {
-            if (mprLookupHash(ejs->standardSpaces, names->entries[slotNum].qname.space)) {
-                qname->space = names->entries[slotNum].qname.space;
-            } else {
-                slotNum = -2;
-            }
-        }
     }
-
     return (count <= 1) ? slotNum : -2;
 }
-#endif
 
 /*
  *  Mark the object properties for the garbage collector
@@ -613,6 +597,7 @@ static int setObjectProperty(Ejs *ejs, EjsObject *obj, int slotNum, EjsVar *valu
         value->permanent = 1;
     }
     mprAssert(value);
+    ejsWriteBarrier(ejs, obj, value);
     obj->slots[slotNum] = value;
     return slotNum;
 }
@@ -626,6 +611,7 @@ static int setObjectProperty(Ejs *ejs, EjsObject *obj, int slotNum, EjsVar *valu
 static int setObjectPropertyName(Ejs *ejs, EjsObject *obj, int slotNum, EjsName *qname)
 {
     EjsNames    *names;
+    EjsBlock    *instanceBlock;
 
     mprAssert(obj);
     mprAssert(qname);
@@ -635,6 +621,13 @@ static int setObjectPropertyName(Ejs *ejs, EjsObject *obj, int slotNum, EjsName
         return EJS_ERR;
     }
 
+    /*
+     *  Plain dynamic objects share names with other objects that added the same properties in the same order
+     */
+    if (setShapePropertyName(ejs, obj, slotNum, qname) == 0) {
+        return slotNum;
+    }
+
     /*
      *  If the hash is owned by the base type and this is a dynamic object, we need a new hash dedicated to the object.
      */
@@ -643,9 +636,9 @@ static int setObjectPropertyName(Ejs *ejs, EjsObject *obj, int slotNum, EjsName
             return EJS_ERR;
         }
 
-    } else if (obj->var.dynamic && obj != mprGetParent(obj->names)) {
+    } else if ((obj->var.dynamic || obj->names->shared) && obj != mprGetParent(obj->names)) {
         /*
-         *  Object is using the type's original names, must copy and use own names from here on.
+         *  Object is using the type's original names or a shared snapshot, must copy and use own names from here on.
          */
         if (ejsGrowObjectNames(obj, obj->numProp) < 0) {
             return EJS_ERR;
@@ -668,10 +661,19 @@ static int setObjectPropertyName(Ejs *ejs, EjsObject *obj, int slotNum, EjsName
         removeHashEntry(obj, &names->entries[slotNum].qname);
     }
 
+    /*
+     *  Changing type names or names shared with instances invalidates cached property lookups
+     */
+    instanceBlock = obj->var.type->instanceBlock;
+    if (obj->var.isType || obj->var.isInstanceBlock || (instanceBlock && names == instanceBlock->obj.names)) {
+        ejsResetInlineCache(ejs);
+    }
+
     /*
      *  Set the property name
      */
     names->entries[slotNum].qname = *qname;
+    updateGeneration(ejs, obj);
     
     mprAssert(slotNum < obj->numProp);
     mprAssert(obj->numProp <= obj->capacity);
@@ -746,6 +748,54 @@ int ejsGrowObject(Ejs *ejs, EjsObject *obj, int count)
 }
 
 
+/*
+ *  Ensure the object has room for count properties without changing the number of properties. Used when the 
+ *  properties will be defined one at a time by name.
+ */
+int ejsReserveObjectSlots(Ejs *ejs, EjsObject *obj, int count)
+{
+    if (count > obj->capacity) {
+        return growSlots(ejs, obj, count);
+    }
+    return 0;
+}
+
+
+/*
+ *  Define a property using name strings allocated by the caller. Space may be null for the empty namespace. Objects
+ *  with private names take ownership of the strings. Otherwise the strings are freed as shapes keep interned copies.
+ *  This avoids interning names, which are never freed, for objects that don't get a shape.
+ */
+int ejsSetPropertyByAllocatedName(Ejs *ejs, EjsObject *obj, char *space, char *name, EjsVar *value)
+{
+    EjsName     qname, *np;
+    int         slotNum;
+
+    ejsName(&qname, space ? space : EJS_EMPTY_NAMESPACE, name);
+    slotNum = ejsSetPropertyByName(ejs, (EjsVar*) obj, &qname, value);
+
+    np = 0;
+    if (slotNum >= 0 && obj->names && !obj->names->shared && slotNum < obj->names->sizeEntries) {
+        np = &obj->names->entries[slotNum].qname;
+    }
+    if (np && np->name == name) {
+        mprStealBlock(obj, name);
+        obj->var.noPool = 1;
+    } else {
+        mprFree(name);
+    }
+    if (space) {
+        if (np && np->space == space) {
+            mprStealBlock(obj, space);
+            obj->var.noPool = 1;
+        } else {
+            mprFree(space);
+        }
+    }
+    return slotNum;
+}
+
+
 /*
  *  Insert new slots at the specified offset and move up slots to make room. Increase numProp.
  */
@@ -762,6 +812,10 @@ int ejsInsertGrowObject(Ejs *ejs, EjsObject *obj, int incr, int offset)
         return 0;
     }
     
+    if (unshareNames(obj) < 0) {
+        return EJS_ERR;
+    }
+
     /*
      *  Base this comparison on numProp and not on capacity as we may already have room to fit the inserted properties.
      */
@@ -802,6 +856,7 @@ int ejsInsertGrowObject(Ejs *ejs, EjsObject *obj, int incr, int offset)
     if (makeHash(obj) < 0) {
         return EJS_ERR;
     }   
+    updateGeneration(ejs, obj);
     return 0;
 }
 
@@ -876,7 +931,11 @@ void ejsRemoveSlot(Ejs *ejs, EjsObject *obj, int slotNum, int compact)
     mprAssert(slotNum >= 0);
     mprAssert(slotNum >= 0);
 
+    if (unshareNames(obj) < 0) {
+        return;
+    }
     names = obj->names;
+    ejsResetInlineCache(ejs);
 
     if (compact) {
         mprAssert(names);
@@ -898,6 +957,215 @@ void ejsRemoveSlot(Ejs *ejs, EjsObject *obj, int slotNum, int compact)
     names->entries[i].nextSlot = -1;
     
     makeHash(obj);
+    updateGeneration(ejs, obj);
+}
+
+
+/******************************* Shape Routines *******************************/
+/*
+ *  Get the root (empty) shape for the interpreter
+ */
+static EjsShape *getRootShape(Ejs *ejs)
+{
+    EjsShape    *shape;
+
+    if ((shape = ejs->shapes) == 0) {
+        if ((shape = mprAllocObjZeroed(ejs, EjsShape)) == 0) {
+            return 0;
+        }
+        shape->ejs = ejs;
+        shape->names.shared = 1;
+        ejs->shapes = shape;
+    }
+    return shape;
+}
+
+
+/*
+ *  Create a child shape with one more property than the parent. Names are interned so they outlive the objects 
+ *  that created them.
+ */
+static EjsShape *createShape(Ejs *ejs, EjsShape *parent, EjsName *qname)
+{
+    EjsShape        *shape;
+    EjsHashEntry    *entries;
+    EjsNames        *names;
+    int             i, numProp, index;
+
+    if ((shape = mprAllocObjZeroed(parent, EjsShape)) == 0) {
+        return 0;
+    }
+    numProp = parent->numProp + 1;
+    shape->ejs = ejs;
+    shape->numProp = numProp;
+    names = &shape->names;
+    names->shared = 1;
+
+    /*
+     *  Reserve a spare entry so objects can grow a slot before naming it without leaving the shape
+     */
+    names->sizeEntries = EJS_PROP_ROUNDUP(numProp + 1);
+    if ((entries = (EjsHashEntry*) mprAlloc(shape, (int) sizeof(EjsHashEntry) * names->sizeEntries)) == 0) {
+        mprFree(shape);
+        return 0;
+    }
+    names->entries = entries;
+    for (i = 0; i < parent->numProp; i++) {
+        entries[i].qname = parent->names.entries[i].qname;
+    }
+    entries[i].qname.name = ejsInternString(ejs, qname->name);
+    entries[i].qname.space = ejsInternString(ejs, qname->space);
+    if (entries[i].qname.name == 0 || entries[i].qname.space == 0) {
+        mprFree(shape);
+        return 0;
+    }
+    for (i = numProp; i < names->sizeEntries; i++) {
+        entries[i].qname.name = "";
+        entries[i].qname.space = "";
+    }
+    for (i = 0; i < names->sizeEntries; i++) {
+        entries[i].nextSlot = -1;
+    }
+    if (numProp > EJS_HASH_MIN_PROP) {
+        names->sizeBuckets = ejsGetHashSize(numProp);
+        if ((names->buckets = (int*) mprAlloc(shape, names->sizeBuckets * (int) sizeof(int))) == 0) {
+            mprFree(shape);
+            return 0;
+        }
+        memset(names->buckets, -1, names->sizeBuckets * sizeof(int));
+        for (i = 0; i < numProp; i++) {
+            index = ejsComputeHashCode(names, &entries[i].qname);
+            entries[i].nextSlot = (names->buckets[index] >= 0) ? names->buckets[index] : -2;
+            names->buckets[index] = i;
+        }
+    }
+    shape->next = parent->children;
+    parent->children = shape;
+    parent->numChildren++;
+    ejs->numShapes++;
+    return shape;
+}
+
+
+/*
+ *  Name a newly appended property by moving the object to a child shape. Returns EJS_ERR if the object can't use
+ *  shapes and must use private names.
+ */
+static int setShapePropertyName(Ejs *ejs, EjsObject *obj, int slotNum, EjsName *qname)
+{
+    EjsShape    *shape, *child;
+    EjsName     *np;
+
+    if (obj->names == 0) {
+        if (!obj->var.dynamic || obj->var.isType || obj->var.isInstanceBlock || obj->var.isFunction || 
+                ejsIsBlock(obj) || obj->var.type->helpers->setPropertyName != 
+                (EjsSetPropertyNameHelper) setObjectPropertyName) {
+            return EJS_ERR;
+        }
+        if ((shape = getRootShape(ejs)) == 0) {
+            return EJS_ERR;
+        }
+    } else if (obj->names->shared) {
+        shape = (EjsShape*) obj->names;
+    } else {
+        return EJS_ERR;
+    }
+    if (slotNum < shape->numProp) {
+        np = &shape->names.entries[slotNum].qname;
+        return CMP_QNAME(np, qname) ? 0 : EJS_ERR;
+    }
+    if (slotNum != shape->numProp || shape->ejs != ejs || qname->name == 0) {
+        return EJS_ERR;
+    }
+    for (child = shape->children; child; child = child->next) {
+        if (CMP_QNAME(&child->names.entries[slotNum].qname, qname)) {
+            break;
+        }
+    }
+    if (child == 0) {
+        if (shape->numProp >= EJS_MAX_SHAPE_PROP || shape->numChildren >= EJS_MAX_SHAPE_CHILDREN || 
+                ejs->numShapes >= EJS_MAX_SHAPES || (child = createShape(ejs, shape, qname)) == 0) {
+            return EJS_ERR;
+        }
+    }
+    if (obj->numProp > child->names.sizeEntries) {
+        return EJS_ERR;
+    }
+    obj->names = &child->names;
+    return 0;
+}
+
+
+/*
+ *  Freeze a copy of an object's property names as a shape that objects in cloned interpreters can share. The shape 
+ *  belongs to this interpreter, so other interpreters never extend it and take a private copy before changing names.
+ */
+EjsShape *ejsCreateSnapshotShape(Ejs *ejs, EjsObject *obj)
+{
+    EjsShape        *shape;
+    EjsNames        *names, *src;
+    int             i, numProp;
+
+    if ((shape = mprAllocObjZeroed(ejs, EjsShape)) == 0) {
+        return 0;
+    }
+    numProp = obj->numProp;
+    shape->ejs = ejs;
+    shape->numProp = numProp;
+    names = &shape->names;
+    names->shared = 1;
+    if (numProp == 0) {
+        return shape;
+    }
+    names->sizeEntries = numProp;
+    if ((names->entries = (EjsHashEntry*) mprAlloc(shape, (int) sizeof(EjsHashEntry) * numProp)) == 0) {
+        mprFree(shape);
+        return 0;
+    }
+    src = obj->names;
+    for (i = 0; i < numProp; i++) {
+        if (src && i < src->sizeEntries) {
+            names->entries[i] = src->entries[i];
+        } else {
+            names->entries[i].qname.name = "";
+            names->entries[i].qname.space = "";
+            names->entries[i].nextSlot = -1;
+        }
+    }
+    if (src && src->buckets) {
+        names->sizeBuckets = src->sizeBuckets;
+        if ((names->buckets = (int*) mprMemdup(shape, src->buckets, src->sizeBuckets * (int) sizeof(int))) == 0) {
+            mprFree(shape);
+            return 0;
+        }
+    }
+    return shape;
+}
+
+
+/*
+ *  Count changes to the global names so that stale snapshots of the global names are detected
+ */
+static void updateGeneration(Ejs *ejs, EjsObject *obj)
+{
+    if ((EjsVar*) obj == ejs->global) {
+        ejs->globalGeneration++;
+    }
+}
+
+
+/*
+ *  Give an object a private copy of shared shape names before modifying them
+ */
+static int unshareNames(EjsObject *obj)
+{
+    if (obj->names && obj->names->shared) {
+        if (ejsGrowObjectNames(obj, obj->numProp) < 0) {
+            return EJS_ERR;
+        }
+        return makeHash(obj);
+    }
+    return 0;
 }
 
 
@@ -951,6 +1219,7 @@ int ejsGrowObjectNames(EjsObject *obj, int size)
         names->entries = 0;
         names->sizeEntries = 0;
         names->sizeBuckets = 0;
+        names->shared = 0;
     }
 
     if (size < names->sizeEntries) {
@@ -969,6 +1238,10 @@ int ejsGrowObjectNames(EjsObject *obj, int size)
         if (entries == 0) {
             return EJS_ERR;
         }
+        /*
+         *  Shared names may have more entries than requested
+         */
+        oldSize = min(oldSize, size);
         if (obj->names) {
             for (i = 0; i < oldSize; i++) {
                 entries[i] = obj->names->entries[i];
@@ -1073,7 +1346,7 @@ static int makeHash(EjsObject *obj)
     /*
      *  Don't make the hash if too few properties. Once we have a hash, keep using it even if we have too few properties now.
      */
-    if (names == 0 || (obj->numProp <= EJS_HASH_MIN_PROP && names->buckets == 0)) {
+    if (names == 0 || names->shared || (obj->numProp <= EJS_HASH_MIN_PROP && names->buckets == 0)) {
         return 0;
     }
 
@@ -1119,6 +1392,9 @@ void ejsResetHash(Ejs *ejs, EjsObject *obj)
     EjsHashEntry    *he;
     int             i;
 
+    if (unshareNames(obj) < 0) {
+        return;
+    }
     names = obj->names;
 
     /*
@@ -1281,7 +1557,6 @@ static inline int cmpQname(EjsName *a, EjsName *b)
 }
 
 
-#if KEEP
 static inline int cmpName(EjsName *a, EjsName *b) 
 {
     mprAssert(a);
@@ -1297,7 +1572,6 @@ static inline int cmpName(EjsName *a, EjsName *b)
     }
     return 0;
 }
-#endif
 
 /*********************************** Methods **********************************/
 /*
@@ -1453,101 +1727,7 @@ static EjsVar *seal(Ejs *ejs, EjsVar *vp, int argc, EjsVar **argv)
  */
 static EjsVar *objectToJson(Ejs *ejs, EjsVar *vp, int argc, EjsVar **argv)
 {
-    MprBuf      *buf;
-    EjsVar      *pp, *result;
-    EjsBlock    *block;
-    EjsName     qname;
-    EjsObject   *obj;
-    EjsString   *sv;
-    char        key[16], *cp;
-    int         c, isArray, i, count, slotNum, numInherited, maxDepth, flags;
-
-    count = ejsGetPropertyCount(ejs, (EjsVar*) vp);
-    if (count == 0 && vp->type != ejs->objectType && vp->type != ejs->arrayType) {
-        return (EjsVar*) ejsToString(ejs, vp);
-    }
-    maxDepth = 99;
-    flags = 0;
-
-    isArray = ejsIsArray(vp);
-    obj = (EjsObject*) vp;
-    buf = mprCreateBuf(ejs, 0, 0);
-    mprPutStringToBuf(buf, isArray ? "[\n" : "{\n");
-
-    if (++ejs->serializeDepth <= maxDepth) {
-
-        for (slotNum = 0; slotNum < count && !ejs->exception; slotNum++) {
-            if (ejsIsBlock(obj)) {
-                block = (EjsBlock*) obj;
-                numInherited = ejsGetNumInheritedTraits(block);
-                if (slotNum < numInherited && !(flags & EJS_FLAGS_ENUM_INHERITED)) {
-                    continue;
-                }
-            }
-            pp = ejsGetProperty(ejs, (EjsVar*) obj, slotNum);
-            if (ejs->exception) {
-                return 0;
-            }
-            if (pp == 0 || (pp->hidden && !(flags & EJS_FLAGS_ENUM_ALL))) {
-                continue;
-            }
-            if (ejsIsFunction(pp) && !(flags & EJS_FLAGS_ENUM_ALL)) {
-                continue;
-            }
-            if (isArray) {
-                mprItoa(key, sizeof(key), slotNum, 10);
-                qname.name = key;
-                qname.space = "";
-            } else {
-                qname = ejsGetPropertyName(ejs, vp, slotNum);
-            }
-
-            if (qname.space && strstr(qname.space, ",private") != 0) {
-                continue;
-            }
-            if (qname.space[0] == '\0' && qname.name[0] == '\0') {
-                continue;
-            }
-            for (i = 0; i < ejs->serializeDepth; i++) {
-                mprPutStringToBuf(buf, "  ");
-            }
-            if (!isArray) {
-                mprPutCharToBuf(buf, '"');
-                for (cp = (char*) qname.name; cp && *cp; cp++) {
-                    c = *cp;
-                    if (c == '"' || c == '\\') {
-                        mprPutCharToBuf(buf, '\\');
-                        mprPutCharToBuf(buf, c);
-                    } else {
-                        mprPutCharToBuf(buf, c);
-                    }
-                }
-                mprPutStringToBuf(buf, "\": ");
-            }
-            sv = (EjsString*) ejsToJson(ejs, pp);
-            if (sv == 0 || !ejsIsString(sv)) {
-                if (!ejs->exception) {
-                    ejsThrowTypeError(ejs, "Can't serialize property %s", qname.name);
-                }
-                return 0;
-            } else {
-                mprPutStringToBuf(buf, sv->value);
-            }
-            if ((slotNum + 1) < count) {
-                mprPutCharToBuf(buf, ',');
-            }
-            mprPutStringToBuf(buf, "\n");
-        }
-    }
-    for (i = --ejs->serializeDepth; i > 0; i--) {
-        mprPutStringToBuf(buf, "  ");
-    }
-    mprPutCharToBuf(buf, isArray ? ']' : '}');
-
-    mprAddNullToBuf(buf);
-    result = (EjsVar*) ejsCreateString(ejs, mprGetBufStart(buf));
-    mprFree(buf);
-    return result;
+    return ejsSerializeObject(ejs, vp, 0, EJS_FLAGS_PRETTY);
 }
 
 
@@ -10,10 +10,38 @@
 
 #if BLD_FEATURE_REGEXP && ES_RegExp
 
+/*
+ *  Compiled pattern shared by all RegExp objects created from the same source and options. Entries are hashed by
+ *  source and kept in least recently used order. An evicted entry is freed when its last RegExp is destroyed.
+ */
+typedef struct EjsRegex {
+    struct EjsRegex *next;              /* Next entry in the hash chain */
+    struct EjsRegex *newer;             /* More recently used entry */
+    struct EjsRegex *older;             /* Less recently used entry */
+    char            *source;            /* Pattern with slash delimiters and flags. For example: /abc/g */
+    char            *pattern;           /* Pattern without delimiters or flags */
+    void            *compiled;          /* Compiled pattern */
+    int             options;            /* Compile options */
+    int             refs;               /* Count of RegExp objects using the compiled pattern */
+    int             evicted;            /* Removed from the cache */
+} EjsRegex;
+
+typedef struct EjsRegexCache {
+    EjsRegex        *buckets[EJS_REGEX_CACHE_SIZE];
+    EjsRegex        *newest;            /* Most recently used entry */
+    EjsRegex        *oldest;            /* Least recently used entry. Evicted first */
+    int             count;              /* Count of cached entries */
+    uint            hits;               /* Patterns found in the cache */
+    uint            misses;             /* Patterns compiled */
+    uint            evictions;          /* Entries evicted to make room */
+} EjsRegexCache;
+
 /***************************** Forward Declarations ***************************/
 
+static void *compileRegExp(Ejs *ejs, EjsRegExp *rp, cchar *source, cchar *pattern);
 static int parseFlags(EjsRegExp *rp, cchar *flags);
 static char *makeFlags(EjsRegExp *rp);
+static void releaseRegExp(EjsRegExp *rp);
 
 /******************************************************************************/
 /*
@@ -49,10 +77,7 @@ static void destroyRegExp(Ejs *ejs, EjsRegExp *rp)
 {
     mprAssert(rp);
 
-    if (rp->compiled) {
-        free(rp->compiled);
-        rp->compiled = 0;
-    }
+    releaseRegExp(rp);
     ejsFreeVar(ejs, (EjsVar*) rp, -1);
 }
 
@@ -66,25 +91,21 @@ static void destroyRegExp(Ejs *ejs, EjsRegExp *rp)
 
 static EjsVar *regexConstructor(Ejs *ejs, EjsRegExp *rp, int argc, EjsVar **argv)
 {
-    cchar       *errMsg, *flags, *pattern;
-    int         column, errCode;
+    cchar       *flags, *pattern;
+    char        *source;
 
     pattern = ejsGetString(argv[0]);
     rp->options = PCRE_JAVASCRIPT_COMPAT;
+    flags = "";
 
     if (argc == 2) {
         flags = ejsGetString(argv[1]);
         rp->options |= parseFlags(rp, flags);
     }
-    rp->pattern = mprStrdup(rp, pattern);
-    if (rp->compiled) {
-        free(rp->compiled);
-    }
-    rp->compiled = (void*) pcre_compile2(rp->pattern, rp->options, &errCode, &errMsg, &column, NULL);
-
-    if (rp->compiled == NULL) {
-        ejsThrowArgError(ejs, "Can't compile regular expression. Error %s at column %d", errMsg, column);
-    }
+    releaseRegExp(rp);
+    source = mprStrcat(rp, -1, "/", pattern, "/", flags, NULL);
+    compileRegExp(ejs, rp, source, pattern);
+    mprFree(source);
     return (EjsVar*) rp;
 }
 
@@ -221,9 +242,7 @@ EjsVar *ejsRegExpToString(Ejs *ejs, EjsRegExp *rp)
 EjsRegExp *ejsCreateRegExp(Ejs *ejs, cchar *pattern)
 {
     EjsRegExp   *rp;
-    cchar       *errMsg;
-    char        *flags;
-    int         column, errCode;
+    cchar       *flags;
 
     mprAssert(pattern[0] == '/');
     
@@ -233,24 +252,213 @@ EjsRegExp *ejsCreateRegExp(Ejs *ejs, cchar *pattern)
     }
     rp = (EjsRegExp*) ejsCreateVar(ejs, ejs->regExpType, 0);
     if (rp != 0) {
-        /*
-            Strip off flags for passing to pcre_compile2
-         */
-        rp->pattern = mprStrdup(rp, &pattern[1]);
-        if ((flags = strrchr(rp->pattern, '/')) != 0) {
+        if ((flags = strrchr(&pattern[1], '/')) != 0) {
             rp->options = parseFlags(rp, &flags[1]);
-            *flags = '\0';
         }
-        if (rp->compiled) {
-            free(rp->compiled);
+        if (compileRegExp(ejs, rp, pattern, 0) == 0) {
+            return 0;
+        }
+    }
+    return rp;
+}
+
+
+/*
+ *  Hash the pattern source and compile options
+ */
+static int hashSource(cchar *source, int options)
+{
+    uint    hash;
+
+    hash = (uint) options;
+    while (*source) {
+        hash = hash * 33 + (uchar) *source++;
+    }
+    return (int) (hash & (EJS_REGEX_CACHE_SIZE - 1));
+}
+
+
+static void unlinkRegex(EjsRegexCache *cache, EjsRegex *rx)
+{
+    if (rx->newer) {
+        rx->newer->older = rx->older;
+    } else {
+        cache->newest = rx->older;
+    }
+    if (rx->older) {
+        rx->older->newer = rx->newer;
+    } else {
+        cache->oldest = rx->newer;
+    }
+    rx->newer = rx->older = 0;
+}
+
+
+static void linkRegex(EjsRegexCache *cache, EjsRegex *rx)
+{
+    rx->older = cache->newest;
+    rx->newer = 0;
+    if (cache->newest) {
+        cache->newest->newer = rx;
+    } else {
+        cache->oldest = rx;
+    }
+    cache->newest = rx;
+}
+
+
+/*
+ *  Remove the least recently used entry. It is freed now if no RegExp objects still use it.
+ */
+static void evictRegex(EjsRegexCache *cache)
+{
+    EjsRegex    *rx, **prevp;
+
+    if ((rx = cache->oldest) == 0) {
+        return;
+    }
+    unlinkRegex(cache, rx);
+    for (prevp = &cache->buckets[hashSource(rx->source, rx->options)]; *prevp; prevp = &(*prevp)->next) {
+        if (*prevp == rx) {
+            *prevp = rx->next;
+            break;
+        }
+    }
+    rx->next = 0;
+    rx->evicted = 1;
+    cache->count--;
+    cache->evictions++;
+    if (rx->refs == 0) {
+        free(rx->compiled);
+        mprFree(rx);
+    }
+}
+
+
+static int destroyRegexCache(EjsRegexCache *cache)
+{
+    EjsRegex    *rx;
+
+    for (rx = cache->newest; rx; rx = rx->older) {
+        free(rx->compiled);
+        rx->compiled = 0;
+    }
+    return 0;
+}
+
+
+/*
+ *  Get the compiled form of a pattern from the interpreter's regular expression cache, compiling it on a miss. The
+ *  source is the pattern with delimiters and flags and is the cache key along with the compile options. If the
+ *  pattern is null, it is extracted from the source. Throws an ArgError if the pattern can't be compiled.
+ */
+static void *compileRegExp(Ejs *ejs, EjsRegExp *rp, cchar *source, cchar *pattern)
+{
+    EjsRegexCache   *cache;
+    EjsRegex        *rx;
+    cchar           *errMsg;
+    char            *cp;
+    void            *compiled;
+    int             column, errCode, index;
+
+    if ((cache = ejs->regexCache) == 0) {
+        cache = mprAllocObjWithDestructorZeroed(ejs, EjsRegexCache, destroyRegexCache);
+        if ((ejs->regexCache = cache) == 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
         }
-        rp->compiled = pcre_compile2(rp->pattern, rp->options, &errCode, &errMsg, &column, NULL);
-        if (rp->compiled == NULL) {
+    }
+    index = hashSource(source, rp->options);
+    for (rx = cache->buckets[index]; rx; rx = rx->next) {
+        if (rx->options == rp->options && strcmp(rx->source, source) == 0) {
+            break;
+        }
+    }
+    if (rx) {
+        cache->hits++;
+        if (rx != cache->newest) {
+            unlinkRegex(cache, rx);
+            linkRegex(cache, rx);
+        }
+
+    } else {
+        cache->misses++;
+        if ((rx = mprAllocObjZeroed(cache, EjsRegex)) == 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+        rx->source = mprStrdup(rx, source);
+        if (pattern) {
+            rx->pattern = mprStrdup(rx, pattern);
+        } else {
+            /*
+             *  Strip off the delimiters and flags for passing to pcre_compile2
+             */
+            rx->pattern = mprStrdup(rx, &source[1]);
+            if ((cp = strrchr(rx->pattern, '/')) != 0) {
+                *cp = '\0';
+            }
+        }
+        compiled = pcre_compile2(rx->pattern, rp->options, &errCode, &errMsg, &column, NULL);
+        if (compiled == NULL) {
+            mprFree(rx);
             ejsThrowArgError(ejs, "Can't compile regular expression. Error %s at column %d", errMsg, column);
             return 0;
         }
+        rx->compiled = compiled;
+        rx->options = rp->options;
+        if (cache->count >= EJS_REGEX_CACHE_SIZE) {
+            evictRegex(cache);
+        }
+        rx->next = cache->buckets[index];
+        cache->buckets[index] = rx;
+        linkRegex(cache, rx);
+        cache->count++;
     }
-    return rp;
+    rx->refs++;
+    rp->regex = rx;
+    rp->pattern = rx->pattern;
+    rp->compiled = rx->compiled;
+    return rp->compiled;
+}
+
+
+/*
+ *  Drop a RegExp's reference to its compiled pattern
+ */
+static void releaseRegExp(EjsRegExp *rp)
+{
+    EjsRegex    *rx;
+
+    if ((rx = rp->regex) != 0) {
+        mprAssert(rx->refs > 0);
+        if (--rx->refs == 0 && rx->evicted) {
+            free(rx->compiled);
+            mprFree(rx);
+        }
+        rp->regex = 0;
+    }
+    rp->compiled = 0;
+    rp->pattern = 0;
+}
+
+
+void ejsPrintRegExpCacheReport(Ejs *ejs)
+{
+    EjsRegexCache   *cache;
+    uint            total;
+
+    if ((cache = ejs->regexCache) == 0) {
+        return;
+    }
+    total = cache->hits + cache->misses;
+    mprLog(ejs, 0, "\nRegular Expression Cache Statistics");
+    mprLog(ejs, 0, "------------------------------------");
+    mprLog(ejs, 0, "  Cached patterns        %,14d of %d", cache->count, EJS_REGEX_CACHE_SIZE);
+    mprLog(ejs, 0, "  Lookups                %,14d", total);
+    mprLog(ejs, 0, "  Hits                   %,14d (%d%%)", cache->hits, 
+        total ? (int) ((cache->hits * 100.0) / total) : 0);
+    mprLog(ejs, 0, "  Evictions              %,14d", cache->evictions);
 }
 
 
@@ -227,9 +227,7 @@ static EjsVar *invokeStringOperator(Ejs *ejs, EjsString *lhs, int opcode,  EjsSt
      *  Binary operators
      */
     case EJS_OP_ADD:
-        result = (EjsVar*) ejsCreateString(ejs, lhs->value);
-        ejsStrcat(ejs, (EjsString*) result, (EjsVar*) rhs);
-        return result;
+        return (EjsVar*) ejsConcatString(ejs, lhs, rhs, 0);
 
     case EJS_OP_AND: case EJS_OP_DIV: case EJS_OP_OR:
     case EJS_OP_SHL: case EJS_OP_SHR: case EJS_OP_USHR: case EJS_OP_XOR:
@@ -1842,6 +1840,57 @@ EjsString *ejsCreateStringWithLength(Ejs *ejs, cchar *value, int len)
 }
 
 
+/*
+ *  Concatenate two strings with one allocation. Strings being built up by repeated "s += str" statements on a local
+ *  variable are given spare room and become builders. The VM clears the builder flag when the string is read a
+ *  second time without being appended, so a builder is only appended in place when no other reference can see it.
+ */
+EjsString *ejsConcatString(Ejs *ejs, EjsString *lhs, EjsString *rhs, int build)
+{
+    EjsString   *sp;
+    char        *buf;
+    int         len, size;
+
+    len = lhs->length + rhs->length;
+
+    if (build && lhs->obj.var.builder && lhs->obj.var.loaded) {
+        size = mprGetBlockSize(lhs->value);
+        if (len >= size) {
+            size = max(len + 1, size * 2);
+            if ((buf = mprRealloc(lhs, lhs->value, size)) == 0) {
+                ejsThrowMemoryError(ejs);
+                return 0;
+            }
+            lhs->value = buf;
+        }
+        memcpy(&lhs->value[lhs->length], rhs->value, rhs->length);
+        lhs->length = len;
+        lhs->value[len] = '\0';
+        lhs->obj.var.loaded = 0;
+        return lhs;
+    }
+    sp = (EjsString*) ejsCreateVar(ejs, ejs->stringType, 0);
+    if (sp == 0) {
+        return 0;
+    }
+    size = len + 1;
+    if (build && len >= EJS_MIN_BUILDER_STRING) {
+        size = len * 2;
+        sp->obj.var.builder = 1;
+    }
+    if ((sp->value = mprAlloc(sp, size)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    memcpy(sp->value, lhs->value, lhs->length);
+    memcpy(&sp->value[lhs->length], rhs->value, rhs->length);
+    sp->value[len] = '\0';
+    sp->length = len;
+    sp->obj.var.primitive = 1;
+    return sp;
+}
+
+
 /*
  *  Initialize an string with a pre-allocated buffer but without data..
  */
@@ -179,6 +179,18 @@ static EjsVar *noexit(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
 }
 
 
+/*
+ *  Print opcode execution statistics
+ *
+ *  static function opStats(): Void
+ */
+static EjsVar *printOpStats(Ejs *ejs, EjsObject *app, int argc, EjsVar **argv)
+{
+    ejsPrintOpStats(ejs);
+    return 0;
+}
+
+
 /*
  *  Get the ejs module search path (EJSPATH). Does not actually read the environment.
  *
@@ -294,6 +306,7 @@ void ejsConfigureAppType(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ejs_sys_App_putenv, (EjsNativeFunction) putEnvVar);
     ejsBindMethod(ejs, type, ES_ejs_sys_App_inputStream, (EjsNativeFunction) getInputStream);
     ejsBindMethod(ejs, type, ES_ejs_sys_App_noexit, (EjsNativeFunction) noexit);
+    ejsBindMethod(ejs, type, ES_ejs_sys_App_opStats, (EjsNativeFunction) printOpStats);
     ejsBindMethod(ejs, type, ES_ejs_sys_App_outputStream, (EjsNativeFunction) getOutputStream);
     ejsBindMethod(ejs, type, ES_ejs_sys_App_searchPath, (EjsNativeFunction) getSearchPath);
     ejsBindMethod(ejs, type, ES_ejs_sys_App_set_searchPath, (EjsNativeFunction) setSearchPath);
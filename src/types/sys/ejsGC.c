@@ -31,11 +31,13 @@ static EjsVar *setEnable(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
 
 /*
  *  run(deep: Boolean = false)
- *  Note: deep currently is not implemented
  */
 static EjsVar *runGC(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
 {
-    ejsCollectGarbage(ejs, EJS_GEN_NEW);
+    int     deep;
+
+    deep = (argc == 1 && ejsIsBoolean(argv[0]) && ejsGetBoolean(argv[0]));
+    ejsCollectGarbage(ejs, deep ? EJS_GEN_OLD : EJS_GEN_NEW);
     return 0;
 }
 
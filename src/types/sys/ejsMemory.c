@@ -147,6 +147,10 @@ static EjsVar *getSystemRam(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
 static EjsVar *printStats(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
 {
     ejsPrintAllocReport(ejs);
+    ejsPrintInlineCacheReport(ejs);
+#if BLD_FEATURE_REGEXP
+    ejsPrintRegExpCacheReport(ejs);
+#endif
     mprPrintAllocReport(ejs, "Memory Report");
     return 0;
 }
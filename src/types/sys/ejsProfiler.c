@@ -0,0 +1,372 @@
+/**
+ *  ejsProfiler.c - Sampling profiler for script code
+ *
+ *  The VM calls ejsSampleProfiler every "interval" calls and branches while the profiler is running. Each sample 
+ *  walks the frame chain and counts the sample against the collapsed call stack. The collapsed stack output is 
+ *  the input format for flame graph tools.
+ *
+ *  Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "ejs.h"
+
+/********************************** Forwards **********************************/
+
+static int compareStacks(cvoid *s1, cvoid *s2);
+static void formatFrame(Ejs *ejs, MprBuf *buf, EjsFrame *fp);
+
+/*********************************** Profiler *********************************/
+/*
+ *  Start sampling every "interval" calls and branches. Samples from a prior run are preserved.
+ */
+int ejsStartProfiler(Ejs *ejs, int interval)
+{
+    EjsProfiler     *profiler;
+
+    if ((profiler = ejs->profiler) == 0) {
+        if ((profiler = mprAllocObjZeroed(ejs, EjsProfiler)) == 0) {
+            return MPR_ERR_NO_MEMORY;
+        }
+        if ((profiler->stacks = mprCreateHash(profiler, 0)) == 0) {
+            mprFree(profiler);
+            return MPR_ERR_NO_MEMORY;
+        }
+        ejs->profiler = profiler;
+    }
+    profiler->interval = (interval > 0) ? interval : EJS_PROFILE_INTERVAL;
+    profiler->countdown = profiler->interval;
+    profiler->running = 1;
+
+    /*
+     *  The VM samples when paying attention. Attention is requested again after each sample while running.
+     */
+    ejs->attention = 1;
+    return 0;
+}
+
+
+void ejsStopProfiler(Ejs *ejs)
+{
+    if (ejs->profiler) {
+        ejs->profiler->running = 0;
+    }
+}
+
+
+/*
+ *  Discard all samples
+ */
+void ejsResetProfiler(Ejs *ejs)
+{
+    EjsProfiler     *profiler;
+
+    if ((profiler = ejs->profiler) != 0) {
+        mprFree(profiler->stacks);
+        profiler->stacks = mprCreateHash(profiler, 0);
+        profiler->samples = 0;
+        profiler->countdown = profiler->interval;
+    }
+}
+
+
+/*
+ *  Count a sample against the current call stack. Frames are listed from the outermost call to the innermost.
+ */
+void ejsSampleProfiler(Ejs *ejs)
+{
+    EjsProfiler     *profiler;
+    EjsFrame        *fp, *frames[EJS_PROFILE_MAX_DEPTH];
+    MprHash         *hp;
+    MprBuf          *buf;
+    cchar           *key;
+    int             depth, oldFlags;
+
+    profiler = ejs->profiler;
+    profiler->countdown = profiler->interval;
+
+    depth = 0;
+    for (fp = ejs->state->fp; fp && depth < EJS_PROFILE_MAX_DEPTH; fp = fp->caller) {
+        frames[depth++] = fp;
+    }
+    if (depth == 0 || profiler->stacks == 0 || (buf = mprCreateBuf(profiler, MPR_BUFSIZE, -1)) == 0) {
+        return;
+    }
+
+    /*
+     *  Pretend to be the compiler so we can access function frame names. See ejsFormatStack.
+     */
+    oldFlags = ejs->flags;
+    ejs->flags |= EJS_FLAG_COMPILER;
+    while (--depth >= 0) {
+        formatFrame(ejs, buf, frames[depth]);
+        if (depth > 0) {
+            mprPutCharToBuf(buf, ';');
+        }
+    }
+    ejs->flags = oldFlags;
+    mprAddNullToBuf(buf);
+
+    key = mprGetBufStart(buf);
+    if ((hp = mprLookupHashEntry(profiler->stacks, key)) != 0) {
+        hp->data = ITOP(PTOI(hp->data) + 1);
+    } else {
+        mprAddHash(profiler->stacks, key, ITOP(1));
+    }
+    profiler->samples++;
+    mprFree(buf);
+}
+
+
+/*
+ *  Format a frame as "Type.function (file:line)"
+ */
+static void formatFrame(Ejs *ejs, MprBuf *buf, EjsFrame *fp)
+{
+    cchar       *typeName, *functionName;
+
+    typeName = "";
+    functionName = "global";
+    if (fp->function.owner && fp->function.slotNum >= 0) {
+        functionName = ejsGetPropertyName(ejs, fp->function.owner, fp->function.slotNum).name;
+    }
+    if (fp->function.owner && ejsIsType(fp->function.owner)) {
+        typeName = ((EjsType*) fp->function.owner)->qname.name;
+    }
+    if (*typeName) {
+        mprPutFmtToBuf(buf, "%s.", typeName);
+    }
+    mprPutStringToBuf(buf, (functionName && *functionName) ? functionName : "-anonymous-");
+    if (fp->filename) {
+        mprPutFmtToBuf(buf, " (%s:%d)", fp->filename, fp->lineNumber);
+    }
+}
+
+
+/*
+ *  Return the samples in collapsed stack format: one line per call stack with the sample count. Caller must free.
+ */
+char *ejsGetProfile(Ejs *ejs)
+{
+    EjsProfiler     *profiler;
+    MprHash         *hp, **list;
+    MprBuf          *buf;
+    char            *result;
+    int             count, i;
+
+    if ((buf = mprCreateBuf(ejs, MPR_BUFSIZE, -1)) == 0) {
+        return 0;
+    }
+    profiler = ejs->profiler;
+    if (profiler && profiler->stacks && (count = mprGetHashCount(profiler->stacks)) > 0) {
+        if ((list = (MprHash**) mprAlloc(buf, count * sizeof(MprHash*))) == 0) {
+            mprFree(buf);
+            return 0;
+        }
+        i = 0;
+        for (hp = mprGetFirstHash(profiler->stacks); hp && i < count; hp = mprGetNextHash(profiler->stacks, hp)) {
+            list[i++] = hp;
+        }
+        qsort(list, i, sizeof(MprHash*), compareStacks);
+        count = i;
+        for (i = 0; i < count; i++) {
+            mprPutFmtToBuf(buf, "%s %d\n", list[i]->key, PTOI(list[i]->data));
+        }
+    }
+    mprAddNullToBuf(buf);
+    result = mprStealBuf(ejs, buf);
+    mprFree(buf);
+    return result;
+}
+
+
+static int compareStacks(cvoid *s1, cvoid *s2)
+{
+    return strcmp((*(MprHash**) s1)->key, (*(MprHash**) s2)->key);
+}
+
+
+/*
+ *  Write the samples in collapsed stack format to a file. If appending, the same call stack may be listed more than
+ *  once. Flame graph tools add the counts.
+ */
+int ejsWriteProfile(Ejs *ejs, cchar *path, bool append)
+{
+    MprFile     *file;
+    char        *profile;
+    int         len, rc;
+
+    if ((profile = ejsGetProfile(ejs)) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    file = mprOpen(ejs, path, O_CREAT | O_WRONLY | O_BINARY | (append ? O_APPEND : O_TRUNC), 0664);
+    if (file == 0) {
+        mprFree(profile);
+        return MPR_ERR_CANT_OPEN;
+    }
+    rc = 0;
+    len = (int) strlen(profile);
+    if (mprWrite(file, profile, len) != len) {
+        rc = MPR_ERR_CANT_WRITE;
+    }
+    mprFree(file);
+    mprFree(profile);
+    return rc;
+}
+
+
+/************************************ Methods *********************************/
+/*
+ *  native static function get running(): Boolean
+ */
+static EjsVar *getRunning(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    return (EjsVar*) ejsCreateBoolean(ejs, ejs->profiler && ejs->profiler->running);
+}
+
+
+/*
+ *  native static function get samples(): Number
+ */
+static EjsVar *getSamples(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    return (EjsVar*) ejsCreateNumber(ejs, (ejs->profiler) ? ejs->profiler->samples : 0);
+}
+
+
+/*
+ *  native static function get stacks(): String
+ */
+static EjsVar *getStacks(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    EjsVar      *result;
+    char        *profile;
+
+    if ((profile = ejsGetProfile(ejs)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    result = (EjsVar*) ejsCreateString(ejs, profile);
+    mprFree(profile);
+    return result;
+}
+
+
+/*
+ *  native static function reset(): Void
+ */
+static EjsVar *resetProfiler(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    ejsResetProfiler(ejs);
+    return 0;
+}
+
+
+/*
+ *  native static function save(path: String): Void
+ */
+static EjsVar *saveProfile(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    cchar       *path;
+
+    mprAssert(argc == 1 && ejsIsString(argv[0]));
+
+    path = ejsGetString(argv[0]);
+    if (ejsWriteProfile(ejs, path, 0) < 0) {
+        ejsThrowIOError(ejs, "Can't write profile to %s", path);
+    }
+    return 0;
+}
+
+
+/*
+ *  native static function start(interval: Number = 1000): Void
+ */
+static EjsVar *startProfiler(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    int     interval;
+
+    interval = (argc >= 1) ? ejsGetInt(argv[0]) : EJS_PROFILE_INTERVAL;
+    if (interval <= 0) {
+        ejsThrowArgError(ejs, "Bad profiler interval");
+        return 0;
+    }
+    if (ejsStartProfiler(ejs, interval) < 0) {
+        ejsThrowMemoryError(ejs);
+    }
+    return 0;
+}
+
+
+/*
+ *  native static function stop(): Void
+ */
+static EjsVar *stopProfiler(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    ejsStopProfiler(ejs);
+    return 0;
+}
+
+
+void ejsCreateProfilerType(Ejs *ejs)
+{
+    EjsName     qname;
+
+    ejsCreateCoreType(ejs, ejsName(&qname, "ejs.sys", "Profiler"), ejs->objectType, sizeof(EjsObject), 
+        ES_ejs_sys_Profiler, ES_ejs_sys_Profiler_NUM_CLASS_PROP, ES_ejs_sys_Profiler_NUM_INSTANCE_PROP, 
+        EJS_ATTR_NATIVE | EJS_ATTR_OBJECT_HELPERS);
+}
+
+
+void ejsConfigureProfilerType(Ejs *ejs)
+{
+    EjsType         *type;
+
+    type = ejsGetType(ejs, ES_ejs_sys_Profiler);
+
+    ejsBindMethod(ejs, type, ES_ejs_sys_Profiler_running, (EjsNativeFunction) getRunning);
+    ejsBindMethod(ejs, type, ES_ejs_sys_Profiler_samples, (EjsNativeFunction) getSamples);
+    ejsBindMethod(ejs, type, ES_ejs_sys_Profiler_stacks, (EjsNativeFunction) getStacks);
+    ejsBindMethod(ejs, type, ES_ejs_sys_Profiler_reset, (EjsNativeFunction) resetProfiler);
+    ejsBindMethod(ejs, type, ES_ejs_sys_Profiler_save, (EjsNativeFunction) saveProfile);
+    ejsBindMethod(ejs, type, ES_ejs_sys_Profiler_start, (EjsNativeFunction) startProfiler);
+    ejsBindMethod(ejs, type, ES_ejs_sys_Profiler_stop, (EjsNativeFunction) stopProfiler);
+}
+
+
+/*
+ *  @copy   default
+ *  
+ *  Copyright (c) Embedthis Software LLC, 2003-2012. All Rights Reserved.
+ *  Copyright (c) Michael O'Brien, 1993-2012. All Rights Reserved.
+ *  
+ *  This software is distributed under commercial and open source licenses.
+ *  You may use the GPL open source license described below or you may acquire 
+ *  a commercial license from Embedthis Software. You agree to be fully bound 
+ *  by the terms of either license. Consult the LICENSE.TXT distributed with 
+ *  this software for full details.
+ *  
+ *  This software is open source; you can redistribute it and/or modify it 
+ *  under the terms of the GNU General Public License as published by the 
+ *  Free Software Foundation; either version 2 of the License, or (at your 
+ *  option) any later version. See the GNU General Public License for more 
+ *  details at: http://www.embedthis.com/downloads/gplLicense.html
+ *  
+ *  This program is distributed WITHOUT ANY WARRANTY; without even the 
+ *  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+ *  
+ *  This GPL license does NOT permit incorporating this software into 
+ *  proprietary programs. If you are unable to comply with the GPL, you must
+ *  acquire a commercial license to use this software. Commercial licenses 
+ *  for this software and support services are available from Embedthis 
+ *  Software at http://www.embedthis.com 
+ *  
+ *  Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -14,7 +14,7 @@
 typedef struct Message {
     EjsWorker   *worker;
     cchar       *callback;
-    char        *data;
+    MprBuf      *data;
     char        *message;
     char        *filename;
     char        *stack;
@@ -25,6 +25,7 @@ typedef struct Message {
 /*********************************** Forwards *********************************/
 
 static void addWorker(Ejs *ejs, EjsWorker *worker);
+static EjsVar *cloneResult(Ejs *ejs, EjsVar *result);
 static int join(Ejs *ejs, EjsVar *workers, int timeout);
 static void handleError(Ejs *ejs, EjsWorker *worker, EjsVar *exception);
 static void loadFile(EjsWorker *insideWorker, cchar *filename);
@@ -74,7 +75,7 @@ static EjsVar *workerConstructor(Ejs *ejs, EjsWorker *worker, int argc, EjsVar *
     /*
      *  Create a new interpreter and an "inside" worker object and pair it with the current "outside" worker.
      */
-    wejs = ejsCreate(ejs->service, NULL, search, 0);
+    wejs = ejsCreate(ejs->service, NULL, search, ejs->flags & EJS_FLAG_JIT);
     if (wejs == 0) {
         ejsThrowMemoryError(ejs);
         return 0;
@@ -146,6 +147,23 @@ static void removeWorker(Ejs *ejs, EjsWorker *worker)
 }
 
 
+/*
+ *  Copy the result of a worker script into this interpreter
+ */
+static EjsVar *cloneResult(Ejs *ejs, EjsVar *result)
+{
+    MprBuf      *buf;
+    EjsVar      *vp;
+
+    if ((buf = ejsEncodeClone(ejs, ejs, result, NULL)) == 0) {
+        return ejs->nullValue;
+    }
+    vp = ejsDecodeClone(ejs, mprGetBufStart(buf), mprGetBufLength(buf), 0);
+    mprFree(buf);
+    return vp;
+}
+
+
 /*
  *  Start a worker thread. This is called by eval() and load(). Not by preload() or by Worker()
  *  It always joins.
@@ -153,7 +171,6 @@ static void removeWorker(Ejs *ejs, EjsWorker *worker)
 static EjsVar *startWorker(Ejs *ejs, EjsWorker *worker, int timeout)
 {
     Ejs     *inside;
-    EjsVar  *result;
 
     mprAssert(ejs);
     mprAssert(worker);
@@ -187,11 +204,7 @@ static EjsVar *startWorker(Ejs *ejs, EjsWorker *worker, int timeout)
     mprAssert(worker->pair);
     mprAssert(worker->pair->ejs);
     inside = worker->pair->ejs;
-    result = ejsSerialize(ejs, inside->result, -1, 0, 0);
-    if (result == 0) {
-        return ejs->nullValue;
-    }
-    return ejsDeserialize(ejs, (EjsString*) result);
+    return cloneResult(ejs, inside->result);
 }
 
 
@@ -382,7 +395,7 @@ static EjsVar *workerLookup(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
 static void doMessage(Message *msg, MprEvent *mprEvent)
 {
     Ejs         *ejs;
-    EjsVar      *event;
+    EjsVar      *event, *data;
     EjsWorker   *worker;
     EjsFunction *callback;
     EjsVar      *argv[1];
@@ -408,7 +421,10 @@ static void doMessage(Message *msg, MprEvent *mprEvent)
         return;
     }
     if (msg->data) {
-        ejsSetProperty(ejs, event, ES_ejs_events_Event_data, (EjsVar*) ejsCreateStringAndFree(ejs, msg->data));
+        data = ejsDecodeClone(ejs, mprGetBufStart(msg->data), mprGetBufLength(msg->data), 1);
+        if (data) {
+            ejsSetProperty(ejs, event, ES_ejs_events_Event_data, data);
+        }
     }
     if (msg->message) {
         ejsSetProperty(ejs, event, ES_ejs_events_ErrorEvent_message, (EjsVar*) ejsCreateStringAndFree(ejs, msg->message));
@@ -462,7 +478,6 @@ static EjsVar *workerPreload(Ejs *ejs, EjsWorker *worker, int argc, EjsVar **arg
 {
     Ejs         *inside;
     EjsWorker   *insideWorker;
-    EjsVar      *result;
 
     mprAssert(argc > 0 && ejsIsPath(argv[0]));
     mprAssert(!worker->inside);
@@ -479,22 +494,18 @@ static EjsVar *workerPreload(Ejs *ejs, EjsWorker *worker, int argc, EjsVar **arg
         handleError(ejs, worker, inside->exception);
         return 0;
     }
-    result = ejsSerialize(ejs, inside->result, -1, 0, 0);
-    if (result == 0) {
-        return ejs->nullValue;
-    }
-    return ejsDeserialize(ejs, (EjsString*) result);
+    return cloneResult(ejs, inside->result);
 }
 
 
 /*
  *  Post a message to this worker. Note: the worker is the destination worker which may be the parent.
  *
- *  function postMessage(data: Object, ports: Array = null): Void
+ *  function postMessage(data: Object, transfer: Array = null): Void
  */
 static EjsVar *workerPostMessage(Ejs *ejs, EjsWorker *worker, int argc, EjsVar **argv)
 {
-    EjsVar          *data;
+    EjsArray        *transfer;
     EjsWorker       *target;
     MprDispatcher   *dispatcher;
     Message         *msg;
@@ -504,19 +515,21 @@ static EjsVar *workerPostMessage(Ejs *ejs, EjsWorker *worker, int argc, EjsVar *
         return 0;
     }
 
-    /*
-     *  Create the event with serialized data in the originating interpreter. It owns the data.
-     */
-    if ((data = ejsSerialize(ejs, argv[0], -1, 0, 0)) == 0) {
-        ejsThrowArgError(ejs, "Can't serialize message data");
-        return 0;
-    }
     if ((msg = mprAllocObjZeroed(ejs, Message)) == 0) {
         ejsThrowMemoryError(ejs);
         return 0;
     }
+
+    /*
+     *  Encode the data in the originating interpreter. The message owns the encoding and the target decodes it.
+     *  Transferred byte array buffers are moved with the encoding and adopted by the target without copying.
+     */
+    transfer = (argc >= 2 && ejsIsArray(argv[1])) ? (EjsArray*) argv[1] : NULL;
+    if ((msg->data = ejsEncodeClone(ejs, msg, argv[0], transfer)) == 0) {
+        mprFree(msg);
+        return 0;
+    }
     target = worker->pair;
-    msg->data = mprStrdup(target->ejs, ejsGetString(data));
     msg->worker = target;
     msg->callback = "onmessage";
     msg->callbackSlot = ES_ejs_sys_Worker_onmessage;
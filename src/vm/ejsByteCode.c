@@ -18,6 +18,109 @@ EjsOptable *ejsGetOptable(MprCtx ctx)
 }
 
 
+/*
+ *  Return the number of opcodes in the table
+ */
+int ejsGetOpcodeCount(EjsOptable *optable)
+{
+    EjsOptable  *opt;
+    int         count;
+
+    for (count = 0, opt = optable; opt->name; opt++) {
+        count++;
+    }
+    return count;
+}
+
+
+/*
+ *  Step over an instruction and its operands. Returns null if the instruction can't be decoded.
+ */
+uchar *ejsGetNextInstruction(EjsOptable *optable, int maxOp, uchar *pc)
+{
+    int     *argp, opcode, t;
+
+    opcode = *pc++;
+    if (opcode >= maxOp) {
+        mprAssert(0);
+        return 0;
+    }
+    if (opcode == EJS_OP_DEBUG) {
+        ejsDecodeNum(&pc);
+        ejsDecodeNum(&pc);
+        ejsDecodeNum(&pc);
+        return pc;
+    }
+    for (argp = optable[opcode].args; *argp; argp++) {
+        switch (*argp) {
+        case EBC_BYTE:
+        case EBC_JMP8:
+            pc++;
+            break;
+
+        case EBC_DOUBLE:
+            pc += sizeof(double);
+            break;
+
+        case EBC_JMP:
+            pc += 4;
+            break;
+
+        case EBC_NUM:
+        case EBC_STRING:
+        case EBC_SLOT:
+        case EBC_ARGC:
+        case EBC_ARGC2:
+        case EBC_ARGC3:
+            ejsDecodeNum(&pc);
+            break;
+
+        case EBC_GLOBAL:
+            t = (int) ejsDecodeNum(&pc);
+            if (t >= 0 && (t & EJS_ENCODE_GLOBAL_MASK) == EJS_ENCODE_GLOBAL_NAME) {
+                ejsDecodeNum(&pc);
+            }
+            break;
+
+        case EBC_INIT_DEFAULT8:
+            pc += 1 + *pc;
+            break;
+
+        case EBC_INIT_DEFAULT:
+            pc += 1 + (*pc * 4);
+            break;
+
+        default:
+            mprAssert(0);
+            return 0;
+        }
+    }
+    return pc;
+}
+
+
+/*
+ *  Map a generic operator to its number specialized form
+ */
+int ejsGetNumberOpcode(int opcode)
+{
+    switch (opcode) {
+    case EJS_OP_ADD:            return EJS_OP_ADD_NUM;
+    case EJS_OP_SUB:            return EJS_OP_SUB_NUM;
+    case EJS_OP_MUL:            return EJS_OP_MUL_NUM;
+    case EJS_OP_DIV:            return EJS_OP_DIV_NUM;
+    case EJS_OP_INC:            return EJS_OP_INC_NUM;
+    case EJS_OP_COMPARE_EQ:     return EJS_OP_COMPARE_EQ_NUM;
+    case EJS_OP_COMPARE_NE:     return EJS_OP_COMPARE_NE_NUM;
+    case EJS_OP_COMPARE_LT:     return EJS_OP_COMPARE_LT_NUM;
+    case EJS_OP_COMPARE_LE:     return EJS_OP_COMPARE_LE_NUM;
+    case EJS_OP_COMPARE_GT:     return EJS_OP_COMPARE_GT_NUM;
+    case EJS_OP_COMPARE_GE:     return EJS_OP_COMPARE_GE_NUM;
+    }
+    return opcode;
+}
+
+
 /*
  *  @copy   default
  *
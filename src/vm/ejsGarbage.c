@@ -1,8 +1,13 @@
 /**
  *  ejsGarbage.c - EJS Garbage collector.
  *
- *  This implements a non-compacting, generational mark and sweep collection algorithm with 
- *  fast pooled object allocations.
+ *  This implements a non-compacting, generational mark and sweep collection algorithm with fast pooled object
+ *  allocations from size class free lists (slabs). New objects are allocated into the new generation and are promoted
+ *  to the old generation after surviving two collections. Minor collections mark from the roots and the remembered
+ *  set and sweep only the new generation. Old objects are not rescanned by minor collections, so stores into old
+ *  objects go through a write barrier (ejsWriteBarrier) that adds the object to the remembered set. Major
+ *  collections mark and sweep all generations and run every EJS_GC_MAJOR_INTERVAL minor collections or when memory
+ *  is short.
  *
  *  Copyright (c) All Rights Reserved. See details at the end of the file.
  */
@@ -12,12 +17,19 @@
 
 /****************************** Forward Declarations **************************/
 
+static EjsSlab *createSlab(Ejs *ejs, int index);
+static void filterRemembered(Ejs *ejs);
 static void mark(Ejs *ejs, int generation);
 static void markGlobal(Ejs *ejs, int generation);
+static void markRemembered(Ejs *ejs);
+static void markUnswept(Ejs *ejs, int generation, bool minor);
 static inline bool memoryUsageOk(Ejs *ejs);
-static inline void pruneTypePools(Ejs *ejs);
-static void resetMarks(Ejs *ejs);
+static inline void pruneSlabs(Ejs *ejs);
+static int remember(Ejs *ejs, EjsVar *vp);
+static void resetMarks(Ejs *ejs, bool minor);
 static void sweep(Ejs *ejs, int generation);
+static void tenure(Ejs *ejs, int generation);
+static void trimRemembered(Ejs *ejs);
 
 #if BLD_DEBUG
 /*
@@ -57,6 +69,7 @@ static int nextSequence;
 int ejsCreateGCService(Ejs *ejs)
 {
     EjsGC       *gc;
+    EjsPool     *pools;
     int         i;
 
     mprAssert(ejs);
@@ -71,8 +84,19 @@ int ejsCreateGCService(Ejs *ejs)
     for (i = 0; i < EJS_MAX_GEN; i++) {
         gc->generations[i] = mprAllocObjZeroed(ejs->heap, EjsGen);
     }
+    /*
+     *  Allocate the type statistics in one block to make interpreter creation fast. Slabs are created on demand.
+     */
+    if ((pools = (EjsPool*) mprAllocZeroed(ejs->heap, EJS_MAX_TYPE * (int) sizeof(EjsPool))) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
     for (i = 0; i < EJS_MAX_TYPE; i++) {
-        gc->pools[i] = mprAllocObjZeroed(ejs->heap, EjsPool);
+        gc->pools[i] = &pools[i];
+    }
+    gc->sizeRemembered = EJS_NUM_CROSS_GEN;
+    gc->remembered = (EjsVar**) mprAlloc(ejs->heap, gc->sizeRemembered * sizeof(EjsVar*));
+    if (gc->remembered == 0) {
+        return MPR_ERR_NO_MEMORY;
     }
     ejs->currentGeneration = ejs->gc.generations[EJS_GEN_ETERNAL];
     return 0;
@@ -104,14 +128,52 @@ void ejsDestroyGCService(Ejs *ejs)
 
 /*
  *  Allocate a new variable. Size is set to the extra bytes for properties in addition to the type's instance size.
+ *  Objects are allocated in size classes so that freed objects of any type can be reused by other types of a similar 
+ *  size.
  */
 EjsVar *ejsAllocVar(Ejs *ejs, EjsType *type, int extra)
 {
+    EjsSlab     *slab;
     EjsVar      *vp;
+    MprBlk      *bp, *gp;
+    int         size, index;
 
     mprAssert(type);
 
-    if ((vp = (EjsVar*) mprAllocZeroed(ejsGetAllocCtx(ejs), type->instanceSize + extra)) == 0) {
+    size = (int) EJS_SLAB_SIZE(type->instanceSize + extra);
+    index = size / EJS_SLAB_QUANTUM;
+
+    if (index < EJS_NUM_SLABS && !type->dontPool && ejs->gc.slabs[index] && 
+            (bp = mprGetFirstChild(ejs->gc.slabs[index])) != NULL) {
+        /*
+         *  Transfer from the slab to the current generation. Inline for speed.
+         */
+        slab = ejs->gc.slabs[index];
+        gp = MPR_GET_BLK(ejs->currentGeneration);
+        if (bp->prev) {
+            bp->prev->next = bp->next;
+        } else {
+            bp->parent->children = bp->next;
+        }
+        if (bp->next) {
+            bp->next->prev = bp->prev;
+        }
+        bp->parent = gp;
+        if (gp->children) {
+            gp->children->prev = bp;
+        }
+        bp->next = gp->children;
+        gp->children = bp;
+        bp->prev = 0;
+        slab->count--;
+        mprAssert(slab->count >= 0);
+#if BLD_DEBUG
+        slab->reuse++;
+#endif
+        vp = MPR_GET_PTR(bp);
+        memset(vp, 0, size);
+
+    } else if ((vp = (EjsVar*) mprAllocZeroed(ejsGetAllocCtx(ejs), size)) == 0) {
         ejsThrowMemoryError(ejs);
         return 0;
     }
@@ -126,68 +188,17 @@ EjsVar *ejsAllocVar(Ejs *ejs, EjsType *type, int extra)
 }
 
 
-EjsVar *ejsAllocPooledVar(Ejs *ejs, int id)
-{
-    EjsPool     *pool;
-    EjsVar      *vp;
-    MprBlk      *bp, *gp;
-
-    if (id < ejs->gc.numPools) {
-        pool = ejs->gc.pools[id];
-        if ((bp = mprGetFirstChild(pool)) != NULL) {
-            /*
-             *  Transfer from the pool to the current generation. Inline for speed.
-             */
-            gp = MPR_GET_BLK(ejs->currentGeneration);
-            if (bp->prev) {
-                bp->prev->next = bp->next;
-            } else {
-                bp->parent->children = bp->next;
-            }
-            if (bp->next) {
-                bp->next->prev = bp->prev;
-            }
-            bp->parent = gp;
-            if (gp->children) {
-                gp->children->prev = bp;
-            }
-            bp->next = gp->children;
-            gp->children = bp;
-            bp->prev = 0;
-
-            vp = MPR_GET_PTR(bp);
-            memset(vp, 0, pool->type->instanceSize);
-            vp->type = pool->type;
-            vp->master = (ejs->master == 0);
-#if BLD_DEBUG
-            vp->seq = nextSequence++;
-            checkAddr((EjsVar*) vp);
-            pool->reuse++;
-            pool->count--;
-            mprAssert(pool->count >= 0);
-            ejsAddToGcStats(ejs, vp, id);
-#endif
-            if (++ejs->workDone >= ejs->workQuota) {
-                ejs->gcRequired = 1;
-                ejs->attention = 1;
-            }
-            return vp;
-        }
-    }
-    return 0;
-}
-
-
 /*
  *  Free a variable. This is should only ever be called by the destroyVar helpers to free a object or recycle the 
- *  object to a type specific free pool. 
+ *  object to the free list of its size class. The id is the type id for allocation statistics.
  */
 void ejsFreeVar(Ejs *ejs, EjsVar *vp, int id)
 {
     EjsType     *type;
-    EjsPool     *pool;
+    EjsSlab     *slab;
     EjsGC       *gc;
     MprBlk      *bp, *pp;
+    int         index;
 
     mprAssert(vp);
     checkAddr(vp);
@@ -197,15 +208,31 @@ void ejsFreeVar(Ejs *ejs, EjsVar *vp, int id)
     if (id < 0) {
         id = type->id;
     }
-    pool = gc->pools[id];
+#if BLD_DEBUG
+    if (0 <= id && id < gc->numPools) {
+        gc->pools[id]->allocated--;
+        mprAssert(gc->pools[id]->allocated >= 0);
+    }
+    vp->type = (void*) -1;
+#endif
+    bp = MPR_GET_BLK(vp);
 
-    if (!vp->noPool && !type->dontPool && 0 <= id && id < gc->numPools && pool->count < EJS_MAX_TYPE_POOL) {
+    /*
+     *  Round down so the object is at least as large as its size class. Blocks with destructors are not pooled.
+     */
+    index = (int) (bp->size - MPR_ALLOC_HDR_SIZE) / EJS_SLAB_QUANTUM;
+
+    slab = 0;
+    if (!vp->noPool && !type->dontPool && index < EJS_NUM_SLABS && !(bp->flags & MPR_ALLOC_HAS_DESTRUCTOR)) {
+        if ((slab = gc->slabs[index]) == 0) {
+            slab = createSlab(ejs, index);
+        }
+    }
+    if (slab && slab->count < EJS_MAX_SLAB_POOL) {
         /*
-         *  Transfer from the current generation back to the pool. Inline for speed.
+         *  Transfer from the current generation back to the slab. Inline for speed.
          */
-        pool->type = vp->type; 
-        pp = MPR_GET_BLK(pool);
-        bp = MPR_GET_BLK(vp);
+        pp = MPR_GET_BLK(slab);
         if (bp->prev) {
             bp->prev->next = bp->next;
         } else {
@@ -217,9 +244,6 @@ void ejsFreeVar(Ejs *ejs, EjsVar *vp, int id)
         if (bp->children) {
             mprFreeChildren(vp);
         }
-        /*
-         *  Add to the pool
-         */
         bp->parent = pp;
         if (pp->children) {
             pp->children->prev = bp;
@@ -228,32 +252,33 @@ void ejsFreeVar(Ejs *ejs, EjsVar *vp, int id)
         pp->children = bp;
         bp->prev = 0;
 
-#if BLD_DEBUG
-        vp->type = (void*) -1;
-        pool->allocated--;
-        mprAssert(pool->allocated >= 0);
-        pool->count++;
-        if (pool->count > pool->peakCount) {
-            pool->peakCount = pool->count;
+        slab->count++;
+        if (slab->count > slab->peakCount) {
+            slab->peakCount = slab->count;
         }
-#endif
     } else {
-#if BLD_DEBUG
-        vp->type = (void*) -1;
-        if (0 <= id && id < gc->numPools) {
-            pool = gc->pools[id];
-            pool->allocated--;
-            mprAssert(pool->allocated >= 0);
-        }
-#endif
         mprFree(vp);
     }
 }
 
 
+static EjsSlab *createSlab(Ejs *ejs, int index)
+{
+    EjsSlab     *slab;
+
+    if ((slab = mprAllocObjZeroed(ejs->heap, EjsSlab)) != 0) {
+        slab->size = index * EJS_SLAB_QUANTUM;
+        ejs->gc.slabs[index] = slab;
+    }
+    return slab;
+}
+
+
 /*
  *  Collect the garbage. This is a mark and sweep over all possible objects. If an object is not referenced, it and 
- *  all contained properties will be freed. Collection is done in generations.
+ *  all contained properties will be freed. Collection is done in generations. Collecting EJS_GEN_NEW will do a minor 
+ *  collection of only the new generation unless a major collection is due. Collecting EJS_GEN_OLD or EJS_GEN_ETERNAL 
+ *  does a major collection of all generations up to and including the given generation.
  */
 void ejsCollectGarbage(Ejs *ejs, int gen)
 {
@@ -265,10 +290,39 @@ void ejsCollectGarbage(Ejs *ejs, int gen)
     }
     gc->collecting = 1;
 
-    mark(ejs, gen);
-    sweep(ejs, gen);
+    if (gc->tenureEternal) {
+        tenure(ejs, EJS_GEN_ETERNAL);
+        gc->tenureEternal = (gc->allocGeneration == EJS_GEN_ETERNAL);
+    }
+    if (gen == EJS_GEN_NEW && 
+            (++gc->minorCount >= EJS_GC_MAJOR_INTERVAL || gc->rebuildRemembered || !memoryUsageOk(ejs))) {
+        gen = EJS_GEN_OLD;
+    }
+    if (gen == EJS_GEN_NEW) {
+        resetMarks(ejs, 1);
+        mark(ejs, gen);
+        markRemembered(ejs);
+        markUnswept(ejs, gen, 1);
+        sweep(ejs, gen);
+        gc->totalMinor++;
+
+    } else {
+        resetMarks(ejs, 0);
+        mark(ejs, gen);
+        markUnswept(ejs, gen, 0);
+        filterRemembered(ejs);
+        sweep(ejs, gen);
+        if (gc->rebuildRemembered) {
+            gc->rebuildRemembered = 0;
+            tenure(ejs, EJS_GEN_OLD);
+            tenure(ejs, EJS_GEN_ETERNAL);
+        }
+        gc->minorCount = 0;
+        gc->totalMajor++;
+    }
+    trimRemembered(ejs);
     if (!memoryUsageOk(ejs)) {
-        pruneTypePools(ejs);
+        pruneSlabs(ejs);
     }
     ejs->workDone = 0;
     ejs->gcRequired = 0;
@@ -297,7 +351,6 @@ static void mark(Ejs *ejs, int generation)
     gc = &ejs->gc;
     gc->collectGeneration = generation;
 
-    resetMarks(ejs);
     markGlobal(ejs, generation);
 
     if (ejs->result) {
@@ -345,13 +398,14 @@ static void mark(Ejs *ejs, int generation)
 
 
 /*
- *  Sweep up the garbage for a given generation
+ *  Sweep up the garbage for a given generation. Survivors in the new generation are promoted to the old generation 
+ *  on their second collection. Old survivors keep their mark so minor collections will not rescan them.
  */
 static void sweep(Ejs *ejs, int maxGeneration)
 {
     EjsVar      *vp;
     EjsGC       *gc;
-    EjsGen      *gen;
+    EjsGen      *gen, *old;
     MprBlk      *bp, *next;
     int         destroyed, generation;
     
@@ -359,6 +413,8 @@ static void sweep(Ejs *ejs, int maxGeneration)
      *  Go from oldest to youngest incase moving objects to elder generations and we clear the mark.
      */
     gc = &ejs->gc;
+    old = gc->generations[EJS_GEN_OLD];
+
     for (generation = maxGeneration; generation >= 0; generation--) {
         gc->collectGeneration = generation;
         gen = gc->generations[generation];
@@ -368,8 +424,25 @@ static void sweep(Ejs *ejs, int maxGeneration)
             vp = MPR_GET_PTR(bp);
             checkAddr(vp);
             if (!vp->marked && !vp->permanent) {
+                mprAssert(!vp->remembered);
+                if (vp->isType) {
+                    ejsResetInlineCache(ejs);
+                }
                 (vp->type->helpers->destroyVar)(ejs, vp);
                 destroyed++;
+
+            } else if (generation == EJS_GEN_NEW) {
+                if (vp->survived) {
+                    mprStealBlock(old, vp);
+                    vp->old = 1;
+                    if (vp->type->helpers->markVar != ejs->defaultHelpers->markVar) {
+                        remember(ejs, vp);
+                    }
+                    gc->totalPromoted++;
+                } else {
+                    vp->survived = 1;
+                    vp->marked = 0;
+                }
             }
         }
 #if BLD_DEBUG
@@ -383,9 +456,10 @@ static void sweep(Ejs *ejs, int maxGeneration)
 
 
 /*
-    Reset all marks prior to doing a mark/sweep
+    Reset all marks prior to doing a mark/sweep. Minor collections only need to reset the active blocks as sweep 
+    clears the marks of new objects and old objects remain marked.
  */
-static void resetMarks(Ejs *ejs)
+static void resetMarks(Ejs *ejs, bool minor)
 {
     EjsGen      *gen;
     EjsGC       *gc;
@@ -395,7 +469,7 @@ static void resetMarks(Ejs *ejs)
     int         i;
 
     gc = &ejs->gc;
-    for (i = 0; i < EJS_MAX_GEN; i++) {
+    for (i = 0; i < EJS_MAX_GEN && !minor; i++) {
         gen = gc->generations[i];
         for (bp = mprGetFirstChild(gen); bp; bp = bp->next) {
             vp = MPR_GET_PTR(bp);
@@ -470,20 +544,212 @@ void ejsMarkVar(Ejs *ejs, EjsVar *container, EjsVar *vp)
 }
 
 
+/*
+ *  Return true if an object is owned by this interpreter. Objects owned by a master interpreter are never collected 
+ *  by a cloned interpreter.
+ */
+static inline bool isOwned(Ejs *ejs, EjsVar *vp)
+{
+    return ejs->master == 0 || !vp->master;
+}
+
+
+/*
+ *  Return true if an object is in the new generation of this interpreter
+ */
+static inline bool isYoung(Ejs *ejs, EjsVar *vp)
+{
+    return !vp->old && isOwned(ejs, vp);
+}
+
+
+/*
+ *  Plain objects hold all their references in their slots. These are tracked precisely by the write barrier and can 
+ *  leave the remembered set once they no longer reference new objects. All other objects with references (functions, 
+ *  blocks, types, arrays and native objects) may update references without a barrier and so stay remembered.
+ */
+static inline bool isTracked(Ejs *ejs, EjsVar *vp)
+{
+    return vp->type->helpers->markVar == ejs->objectHelpers->markVar;
+}
+
+
+/*
+ *  Called by the write barrier when an old object that is not yet remembered is updated.
+ */
+void ejsRememberVar(Ejs *ejs, EjsVar *obj, EjsVar *value)
+{
+    if (isYoung(ejs, value) && isOwned(ejs, obj)) {
+        remember(ejs, obj);
+    }
+}
+
+
+static int remember(Ejs *ejs, EjsVar *vp)
+{
+    EjsGC       *gc;
+    EjsVar      **remembered;
+    int         size;
+
+    gc = &ejs->gc;
+    if (vp->remembered) {
+        return 0;
+    }
+    if (gc->numRemembered >= gc->sizeRemembered) {
+        size = gc->sizeRemembered * 2;
+        remembered = (EjsVar**) mprRealloc(ejs->heap, gc->remembered, size * sizeof(EjsVar*));
+        if (remembered == 0) {
+            /*
+             *  Minor collections are not safe without a complete remembered set. Force major collections until 
+             *  it can be rebuilt.
+             */
+            gc->totalOverflows++;
+            gc->rebuildRemembered = 1;
+            return MPR_ERR_NO_MEMORY;
+        }
+        gc->remembered = remembered;
+        gc->sizeRemembered = size;
+    }
+    vp->remembered = 1;
+    gc->remembered[gc->numRemembered++] = vp;
+    return 0;
+}
+
+
+/*
+ *  Mark everything referenced by the remembered set. Remembered objects are old and already marked, so ejsMarkVar 
+ *  would not descend into them.
+ */
+static void markRemembered(Ejs *ejs)
+{
+    EjsGC       *gc;
+    EjsVar      *vp;
+    int         i;
+
+    gc = &ejs->gc;
+    for (i = 0; i < gc->numRemembered; i++) {
+        vp = gc->remembered[i];
+        vp->marked = 1;
+        (vp->type->helpers->markVar)(ejs, NULL, vp);
+    }
+}
+
+
+/*
+ *  Objects that will survive the sweep without being marked must keep alive everything they reference. These are 
+ *  permanent objects and, for major collections, all objects in generations that are not being swept. Minor 
+ *  collections rely on the remembered set for objects in elder generations.
+ */
+static void markUnswept(Ejs *ejs, int maxGeneration, bool minor)
+{
+    EjsVar      *vp;
+    MprBlk      *bp;
+    int         generation;
+
+    for (generation = 0; generation < EJS_MAX_GEN; generation++) {
+        if (minor && generation > maxGeneration) {
+            break;
+        }
+        for (bp = mprGetFirstChild(ejs->gc.generations[generation]); bp; bp = bp->next) {
+            vp = MPR_GET_PTR(bp);
+            if (!vp->marked && (vp->permanent || generation > maxGeneration)) {
+                ejsMarkVar(ejs, NULL, vp);
+            }
+        }
+    }
+}
+
+
+/*
+ *  After a major mark, remove remembered objects that are about to be swept
+ */
+static void filterRemembered(Ejs *ejs)
+{
+    EjsGC       *gc;
+    EjsVar      *vp;
+    int         i, count;
+
+    gc = &ejs->gc;
+    for (i = count = 0; i < gc->numRemembered; i++) {
+        vp = gc->remembered[i];
+        if (vp->marked) {
+            gc->remembered[count++] = vp;
+        } else {
+            vp->remembered = 0;
+        }
+    }
+    gc->numRemembered = count;
+}
+
+
+/*
+ *  Remove plain objects from the remembered set that no longer reference new objects.
+ */
+static void trimRemembered(Ejs *ejs)
+{
+    EjsGC       *gc;
+    EjsObject   *obj;
+    EjsVar      *vp;
+    int         i, j, count;
+
+    gc = &ejs->gc;
+    for (i = count = 0; i < gc->numRemembered; i++) {
+        obj = (EjsObject*) gc->remembered[i];
+        if (isTracked(ejs, (EjsVar*) obj)) {
+            for (j = 0; j < obj->numProp; j++) {
+                if ((vp = obj->slots[j]) != 0 && isYoung(ejs, vp)) {
+                    break;
+                }
+            }
+            if (j == obj->numProp) {
+                obj->var.remembered = 0;
+                continue;
+            }
+        }
+        gc->remembered[count++] = (EjsVar*) obj;
+    }
+    gc->numRemembered = count;
+}
+
+
+/*
+ *  Promote all objects in an elder generation to be old and remember those that have references. This is required 
+ *  for objects allocated directly into the eternal generation.
+ */
+static void tenure(Ejs *ejs, int generation)
+{
+    EjsVar      *vp;
+    MprBlk      *bp;
+
+    for (bp = mprGetFirstChild(ejs->gc.generations[generation]); bp; bp = bp->next) {
+        vp = MPR_GET_PTR(bp);
+        vp->old = 1;
+        if (!vp->remembered && vp->type->helpers->markVar != ejs->defaultHelpers->markVar) {
+            if (remember(ejs, vp) < 0) {
+                return;
+            }
+        }
+    }
+}
+
+
+/*
+ *  This runs on every collection. Don't use mprGetAllocStats which queries the O/S for process and system memory.
+ */
 static inline bool memoryUsageOk(Ejs *ejs)
 {
     MprAlloc    *alloc;
     int64        memory;
 
     memory = mprGetUsedMemory(ejs);
-    alloc = mprGetAllocStats(ejs);
+    alloc = &mprGetMpr(ejs)->alloc;
     return memory < alloc->redLine;
 }
 
 
-static inline void pruneTypePools(Ejs *ejs)
+static inline void pruneSlabs(Ejs *ejs)
 {
-    EjsPool     *pool;
+    EjsSlab     *slab;
     EjsGC       *gc;
     EjsVar      *vp;
     MprAlloc    *alloc;
@@ -494,17 +760,17 @@ static inline void pruneTypePools(Ejs *ejs)
     gc = &ejs->gc;
 
     /*
-     *  Still insufficient memory, must reclaim all objects from the type pools.
+     *  Still insufficient memory, must reclaim all objects from the slab free lists.
      */
-    for (i = 0; i < gc->numPools; i++) {
-        pool = gc->pools[i];
-        if (pool->count) {
-            for (bp = mprGetFirstChild(pool); bp; bp = next) {
+    for (i = 0; i < EJS_NUM_SLABS; i++) {
+        slab = gc->slabs[i];
+        if (slab && slab->count) {
+            for (bp = mprGetFirstChild(slab); bp; bp = next) {
                 next = bp->next;
                 vp = MPR_GET_PTR(bp);
                 mprFree(vp);
             }
-            pool->count = 0;
+            slab->count = 0;
         }
     }
     gc->totalRedlines++;
@@ -612,6 +878,9 @@ int ejsSetGeneration(Ejs *ejs, int generation)
     
     old = ejs->gc.allocGeneration;
     ejs->gc.allocGeneration = generation;
+    if (generation == EJS_GEN_ETERNAL) {
+        ejs->gc.tenureEternal = 1;
+    }
     ejs->currentGeneration = ejs->gc.generations[generation];
     return old;
 }
@@ -661,6 +930,7 @@ void ejsPrintAllocReport(Ejs *ejs)
     EjsType         *type;
     EjsGC           *gc;
     EjsPool         *pool;
+    EjsSlab         *slab;
     int             i, typeMemory, count, peakCount, freeCount, peakFreeCount, reuseCount;
 
     gc = &ejs->gc;
@@ -678,7 +948,7 @@ void ejsPrintAllocReport(Ejs *ejs)
      */
     mprLog(ejs, 0, "\nObject Cache Statistics");
     mprLog(ejs, 0, "------------------------");
-    mprLog(ejs, 0, "Name                TypeSize  ObjectSize  ObjectCount  PeakCount  FreeList  PeakFreeList   ReuseCount");
+    mprLog(ejs, 0, "Name                TypeSize  ObjectSize  ObjectCount  PeakCount");
     
     typeMemory = 0;
     count = peakCount = freeCount = peakFreeCount = reuseCount = 0;
@@ -692,24 +962,42 @@ void ejsPrintAllocReport(Ejs *ejs)
             /* Skip type alias (string == String) */
             continue;
         }
-        mprLog(ejs, 0, "%-22s %,5d %,8d %,10d  %,10d, %,9d, %,10d, %,14d", type->qname.name, ejsGetTypeSize(ejs, type), 
-            type->instanceSize, pool->allocated, pool->peakAllocated, pool->count, pool->peakCount, pool->reuse);
+        mprLog(ejs, 0, "%-22s %,5d %,8d %,10d  %,10d", type->qname.name, ejsGetTypeSize(ejs, type), 
+            type->instanceSize, pool->allocated, pool->peakAllocated);
 
         typeMemory += ejsGetTypeSize(ejs, type);
         count += pool->allocated;
         peakCount += pool->peakAllocated;
-        freeCount += pool->count;
-        peakFreeCount += pool->peakCount;
-        reuseCount += pool->reuse;
     }
-    mprLog(ejs, 0, "%-22s                %,10d  %,10d, %,9d, %,10d, %,14d", "Total", 
-        count, peakCount, freeCount, peakFreeCount, reuseCount);
+    mprLog(ejs, 0, "%-22s                %,10d  %,10d", "Total", count, peakCount);
+
+    /*
+     *  Per size class
+     */
+    mprLog(ejs, 0, "\nObject Slab Statistics");
+    mprLog(ejs, 0, "------------------------");
+    mprLog(ejs, 0, "ObjectSize  FreeList  PeakFreeList   ReuseCount");
+    for (i = 0; i < EJS_NUM_SLABS; i++) {
+        slab = gc->slabs[i];
+        if (slab == 0 || slab->peakCount == 0) {
+            continue;
+        }
+        mprLog(ejs, 0, "%,10d %,9d, %,10d, %,14d", slab->size, slab->count, slab->peakCount, slab->reuse);
+        freeCount += slab->count;
+        peakFreeCount += slab->peakCount;
+        reuseCount += slab->reuse;
+    }
+    mprLog(ejs, 0, "%-10s %,9d, %,10d, %,14d", "Total", freeCount, peakFreeCount, reuseCount);
     mprLog(ejs, 0, "\nTotal type memory        %,14d K", typeMemory / 1024);
 
     mprLog(ejs, 0, "\nEJS Garbage Collector Statistics");
     mprLog(ejs, 0, "  Total allocations      %,14d", gc->totalAllocated);
     mprLog(ejs, 0, "  Total reclaimations    %,14d", gc->totalReclaimed);
     mprLog(ejs, 0, "  Total sweeps           %,14d", gc->totalSweeps);
+    mprLog(ejs, 0, "  Minor collections      %,14d", gc->totalMinor);
+    mprLog(ejs, 0, "  Major collections      %,14d", gc->totalMajor);
+    mprLog(ejs, 0, "  Objects promoted       %,14d", gc->totalPromoted);
+    mprLog(ejs, 0, "  Remembered objects     %,14d", gc->numRemembered);
     mprLog(ejs, 0, "  Total redlines         %,14d", gc->totalRedlines);
     mprLog(ejs, 0, "  Object GC work quota   %,14d", ejs->workQuota);
 #endif
@@ -56,11 +56,23 @@
 #define GET_SLOT(obj, slotNum) getSlot(ejs, (EjsObject*) obj, slotNum)
 
 static MPR_INLINE EjsVar *getSlot(Ejs *ejs, EjsObject *obj, int slotNum) {
+    EjsVar      *vp;
+
     if (ejsIsObject(obj) && slotNum < obj->numProp) {
-        return obj->slots[slotNum];
+        vp = obj->slots[slotNum];
     } else {
-        return ejsGetProperty(ejs, (EjsVar*) obj, slotNum);
+        vp = ejsGetProperty(ejs, (EjsVar*) obj, slotNum);
     }
+    if (vp && vp->builder) {
+        /*
+         *  A builder string may be read once to append to it (s += str). A second read may have kept a reference.
+         */
+        if (vp->loaded) {
+            vp->builder = 0;
+        }
+        vp->loaded = 1;
+    }
+    return vp;
 }
 
 /*
@@ -88,12 +100,23 @@ static void callProperty(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc,
 #define THIS            FRAME->function.thisObj
 #define FILL(mark)      while (mark < FRAME->pc) { *mark++ = EJS_OP_NOP; }
 
-#if BLD_DEBUG
+/*
+ *  Count a backward branch. Functions that loop often enough are translated to specialized byte code.
+ */
+#define HEAT(offset) \
+    if (unlikely(ejs->flags & EJS_FLAG_JIT) && offset < 0 && \
+            ++FRAME->function.body.code.heat == EJS_JIT_THRESHOLD) { \
+        translateCode(ejs, &FRAME->function.body.code); \
+    } else
+
+#if BLD_DEBUG || BLD_FEATURE_EJS_OPSTATS
     static EjsOpCode traceCode(Ejs *ejs, EjsOpCode opcode);
-    static int opcount[256];
 #else
     #define traceCode(ejs, opcode) opcode
 #endif
+#if BLD_DEBUG
+    static int opcount[256];
+#endif
 
 #if BLD_UNIX_LIKE || (VXWORKS && !BLD_CC_DIAB)
     #define CASE(opcode) opcode
@@ -136,10 +159,14 @@ static void checkExceptionHandlers(Ejs *ejs);
 static void handleGetters(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj);
 static EjsBlock *popExceptionBlock(Ejs *ejs);
 static void createExceptionBlock(Ejs *ejs, EjsEx *ex, int flags);
-static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *name, bool dup);
+static int lookupCachedVar(Ejs *ejs, uchar *pc, EjsVar *vp, EjsName *qname, EjsLookup *lookup);
+static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *name, bool dup, uchar *pc);
 static MPR_INLINE int storePropertyToSlot(Ejs *ejs, EjsObject *obj, int slotNum, EjsVar *value, EjsVar *thisObj);
 static void storePropertyToScope(Ejs *ejs, EjsName *qname, bool dup);
 static void throwNull(Ejs *ejs);
+static MPR_INLINE int isLocalAppend(Ejs *ejs, EjsFrame *fp, EjsVar *lhs);
+static void quickenCode(Ejs *ejs, EjsCode *code);
+static void translateCode(Ejs *ejs, EjsCode *code);
 
 /************************************* Code ***********************************/
 /*
@@ -165,6 +192,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
     EjsEx           *ex;
     EjsFrame        *newFrame;
     char            *str;
+    uchar           *pc;
     int             i, offset, count, opcode;
 
 #if BLD_UNIX_LIKE || (VXWORKS && !BLD_CC_DIAB)
@@ -228,6 +256,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
             if (FRAME->function.getter) {
                 push(ejs->result);
             }
+            ejsPopFrame(ejs, FRAME);
             FRAME = 0;
             goto done;
 
@@ -241,6 +270,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
             ejs->result = pop(ejs);
             mprAssert(ejs->exception || ejs->result);
             if (FRAME->caller == 0) {
+                ejsPopFrame(ejs, FRAME);
                 goto done;
             }
             state.stack = FRAME->stackReturn;
@@ -249,6 +279,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
             }
             state.bp = FRAME->function.block.prev;
             newFrame = FRAME->caller;
+            ejsPopFrame(ejs, FRAME);
             FRAME = newFrame;
             BREAK;
 
@@ -259,11 +290,13 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
         CASE (EJS_OP_RETURN):
             ejs->result = ejs->undefinedValue;
             if (FRAME->caller == 0) {
+                ejsPopFrame(ejs, FRAME);
                 goto done;
             }
             state.stack = FRAME->stackReturn;
             state.bp = FRAME->function.block.prev;
             newFrame = FRAME->caller;
+            ejsPopFrame(ejs, FRAME);
             FRAME = newFrame;
             BREAK;
 
@@ -730,6 +763,30 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
 #endif
             BREAK;
                 
+        /*
+         *  Load a variable by an unqualified name that is not defined in the inner lexical blocks. The compiler 
+         *  supplies the count of function and let blocks to skip before searching the scope chain.
+         *      GetOuterName        <qname> <depth>
+         *      Stack before (top)  []
+         *      Stack after         [value]
+         */
+        CASE (EJS_OP_GET_OUTER_NAME):
+            qname = GET_NAME();
+            lookup.storing = 0;
+            slotNum = ejsLookupOuterScope(ejs, &qname, GET_INT(), &lookup);
+            if (unlikely(slotNum < 0)) {
+                if (ejs->flags & EJS_FLAG_COMPILER) {
+                    push(ejs->undefinedValue);
+                } else {
+                    ejsThrowReferenceError(ejs, "%s is not defined", qname.name);
+                }
+                CHECK;
+            } else {
+                push(ejsGetProperty(ejs, lookup.obj, slotNum));
+                DO_GETTER(NULL);
+            }
+            BREAK;
+
         /*
          *  Load a property by property name
          *      GetObjName          <qname>
@@ -740,13 +797,24 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
 #if DYNAMIC_BINDING
             mark = FRAME->pc - 1;
 #endif
+            pc = FRAME->pc - 1;
             qname = GET_NAME();
             vp = pop(ejs);
             if (vp == 0 || vp == ejs->nullValue || vp == ejs->undefinedValue) {
                 ejsThrowReferenceError(ejs, "Object reference is null");
                 CHECK; BREAK;
             }
-            v1 = ejsGetVarByName(ejs, vp, &qname, &lookup);
+            if (vp->type->helpers->getPropertyByName) {
+                v1 = ejsGetVarByName(ejs, vp, &qname, &lookup);
+            } else if ((slotNum = lookupCachedVar(ejs, pc, vp, &qname, &lookup)) >= 0) {
+                if (lookup.obj->type->helpers->getProperty == ejs->objectHelpers->getProperty) {
+                    v1 = GET_SLOT(lookup.obj, slotNum);
+                } else {
+                    v1 = ejsGetProperty(ejs, lookup.obj, slotNum);
+                }
+            } else {
+                v1 = 0;
+            }
             push(v1 ? v1 : ejs->undefinedValue);
 #if DYNAMIC_BINDING
             if (lookup.slotNum < 0 || lookup.slotNum > 4096 || ejs->flags & EJS_FLAG_COMPILER) {
@@ -976,9 +1044,10 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
          *      Stack after         []
          */
         CASE (EJS_OP_PUT_OBJ_NAME):
+            pc = FRAME->pc - 1;
             qname = GET_NAME();
             vp = pop(ejs);
-            storeProperty(ejs, vp, &qname, 0);
+            storeProperty(ejs, vp, &qname, 0, pc);
             CHECK; BREAK;
 
         /*
@@ -1004,7 +1073,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
                     qname.space = ejsToString(ejs, v2)->value;
                 }
                 if (qname.name && qname.space) {
-                    storeProperty(ejs, vp, &qname, 1);
+                    storeProperty(ejs, vp, &qname, 1, NULL);
                 }
             }
             CHECK; BREAK;
@@ -1187,6 +1256,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
          *      Stack after         []
          */
         CASE (EJS_OP_CALL_OBJ_NAME):
+            pc = FRAME->pc - 1;
             qname = GET_NAME();
             argc = GET_INT();
             vp = state.stack[-argc];
@@ -1195,7 +1265,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
                 throwNull(ejs);
                 CHECK; BREAK;
             }
-            slotNum = ejsLookupVar(ejs, (EjsVar*) vp, &qname, &lookup);
+            slotNum = lookupCachedVar(ejs, pc, (EjsVar*) vp, &qname, &lookup);
             if (slotNum < 0) {
                 ejsThrowReferenceError(ejs, "Can't find function \"%s\"", qname.name);
             } else {
@@ -1246,6 +1316,43 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
             }
             CHECK; BREAK;
 
+        /*
+         *  Call a function by a name that is not defined in the inner lexical blocks. The "this" object is 
+         *  selected as for CallScopedName.
+         *      CallOuterName       <qname> <depth> <argc>
+         *      Stack before (top)  [args]
+         *      Stack after         []
+         */
+        CASE (EJS_OP_CALL_OUTER_NAME):
+            qname = GET_NAME();
+            i = GET_INT();
+            argc = GET_INT();
+            lookup.storing = 0;
+            slotNum = ejsLookupOuterScope(ejs, &qname, i, &lookup);
+            if (slotNum < 0) {
+                ejsThrowReferenceError(ejs, "Can't find method %s", qname.name);
+                CHECK; BREAK;
+            }
+            fun = (EjsFunction*) ejsGetProperty(ejs, lookup.obj, slotNum);
+            if (!ejsIsFunction(fun)) {
+                callConstructor(ejs, fun, argc, 0);
+            } else {
+                if ((vp = fun->thisObj) == 0) {
+                    if (ejsIsA(ejs, THIS, (EjsType*) lookup.obj)) {
+                        vp = THIS;
+                    } else if (ejsIsType(lookup.obj)) {
+                        vp = lookup.obj;
+                    } else {
+                        vp = ejs->global;
+                    }
+                }
+                if (fun->getter) {
+                    fun = (EjsFunction*) ejsRunFunction(ejs, fun, vp, 0, NULL);
+                }
+                callProperty(ejs, fun, vp, argc, 0);
+            }
+            CHECK; BREAK;
+
         /*
          *  Call a constructor
          *      CallConstructor     <argc>
@@ -1340,6 +1447,8 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
             blk = ejsCreateBlock(ejs, 0);
             ejsSetDebugName(blk, "with");
             memcpy((void*) blk, vp, vp->type->instanceSize);
+            blk->obj.var.old = 0;
+            blk->obj.var.remembered = 0;
             blk->prev = blk->scopeChain = state.bp;
             state.bp->referenced = 1;
             state.bp = blk;
@@ -1363,6 +1472,9 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
             if (type == 0 || !ejsIsType(type)) {
                 ejsThrowReferenceError(ejs, "Reference is not a class");
             } else {
+                if (ejsIsStackFrame(ejs, FRAME)) {
+                    ejsPromoteFrame(ejs, FRAME);
+                }
                 type->block.scopeChain = state.bp;
                 if (type && type->hasStaticInitializer) {
                     //  Static initializer is always immediately after the constructor (if present)
@@ -1388,12 +1500,22 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
          */
         CASE (EJS_OP_DEFINE_FUNCTION):
             slotNum = GET_INT();
+            if (ejsIsStackFrame(ejs, FRAME)) {
+                /*
+                 *  The function may capture the frame. Promote before locating the block as it may be the frame.
+                 */
+                ejsPromoteFrame(ejs, FRAME);
+            }
             vp = getNthBlock(ejs, GET_INT());
             mprAssert(vp != ejs->global);
             fun = (EjsFunction*) GET_SLOT(vp, slotNum);
             if (!ejsIsFunction(fun)) {
                 ejsThrowReferenceError(ejs, "Reference is not a function");
             } else if (fun->fullScope) {
+                if (!fun->body.code.quickened && !ejsIsNativeFunction(fun)) {
+                    /* Quicken the original so the code is not scanned again for every copy */
+                    quickenCode(ejs, &fun->body.code);
+                }
                 fun = ejsCopyFunction(ejs, fun);
                 fun->block.scopeChain = state.bp;
                 state.bp->referenced = 1;
@@ -1582,6 +1704,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
         CASE (EJS_OP_GOTO):
             offset = GET_WORD();
             FRAME->pc = &FRAME->pc[offset];
+            HEAT(offset);
             BREAK;
 
         /*
@@ -1591,6 +1714,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
         CASE (EJS_OP_GOTO_8):
             offset = (schar) GET_BYTE();
             FRAME->pc = &FRAME->pc[offset];
+            HEAT(offset);
             BREAK;
 
         /*
@@ -1659,6 +1783,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
                     FRAME->pc = &FRAME->pc[offset];
                 }
             }
+            HEAT(offset);
             BREAK;
 
         /*
@@ -1933,7 +2058,6 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
          *                          [left]
          *      Stack after         [boolean]
          */
-        CASE (EJS_OP_ADD):
         CASE (EJS_OP_SUB):
         CASE (EJS_OP_MUL):
         CASE (EJS_OP_DIV):
@@ -1951,6 +2075,24 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
             push(ejs->result);
             CHECK; BREAK;
 
+        /*
+         *  Add. Strings are concatenated directly and may be appended in place when stored back to a local (s += str)
+         *      Stack before (top)  [right]
+         *                          [left]
+         *      Stack after         [result]
+         */
+        CASE (EJS_OP_ADD):
+        addExpression:
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (ejsIsString(v1) && ejsIsString(v2)) {
+                v1 = (EjsVar*) ejsConcatString(ejs, (EjsString*) v1, (EjsString*) v2, isLocalAppend(ejs, FRAME, v1));
+                state.stack--;
+                *state.stack = v1;
+                CHECK; BREAK;
+            }
+            goto binaryExpression;
+
         /*
          *  Unary operators
          */
@@ -1999,12 +2141,229 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
          *      Stack after         [result]
          */
         CASE (EJS_OP_INC):
-            v1 = pop(ejs);
             count = (schar) GET_BYTE();
+        incExpression:
+            v1 = pop(ejs);
             result = evalBinaryExpr(ejs, v1, EJS_OP_ADD, (EjsVar*) ejsCreateNumber(ejs, count));
             push(result);
             CHECK; BREAK;
 
+        /*
+         *  Number specialized operators. The compiler emits these for operands declared as numbers. quickenCode and
+         *  translateCode substitute them for the generic operators. Operands that are not both numbers are handled 
+         *  by the generic operator.
+         *      Stack before (top)  [right]
+         *                          [left]
+         *      Stack after         [result]
+         */
+        CASE (EJS_OP_ADD_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                ejs->result = (EjsVar*) ejsCreateNumber(ejs, ((EjsNumber*) v1)->value + ((EjsNumber*) v2)->value);
+                *--state.stack = ejs->result;
+                CHECK; BREAK;
+            }
+            opcode = EJS_OP_ADD;
+            goto addExpression;
+
+        CASE (EJS_OP_SUB_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                ejs->result = (EjsVar*) ejsCreateNumber(ejs, ((EjsNumber*) v1)->value - ((EjsNumber*) v2)->value);
+                *--state.stack = ejs->result;
+                CHECK; BREAK;
+            }
+            opcode = EJS_OP_SUB;
+            goto binaryExpression;
+
+        CASE (EJS_OP_MUL_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                ejs->result = (EjsVar*) ejsCreateNumber(ejs, ((EjsNumber*) v1)->value * ((EjsNumber*) v2)->value);
+                *--state.stack = ejs->result;
+                CHECK; BREAK;
+            }
+            opcode = EJS_OP_MUL;
+            goto binaryExpression;
+
+        CASE (EJS_OP_DIV_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+#if BLD_FEATURE_NUM_TYPE_DOUBLE
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+#else
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType && 
+                    ((EjsNumber*) v2)->value != 0)) {
+#endif
+                ejs->result = (EjsVar*) ejsCreateNumber(ejs, ((EjsNumber*) v1)->value / ((EjsNumber*) v2)->value);
+                *--state.stack = ejs->result;
+                CHECK; BREAK;
+            }
+            opcode = EJS_OP_DIV;
+            goto binaryExpression;
+
+        /*
+         *  Number specialized increment
+         *      IncNum              <increment>
+         *      Stack before (top)  [value]
+         *      Stack after         [result]
+         */
+        CASE (EJS_OP_INC_NUM):
+            count = (schar) GET_BYTE();
+            v1 = state.stack[0];
+            if (likely(v1 && v1->type == ejs->numberType)) {
+                *state.stack = (EjsVar*) ejsCreateNumber(ejs, ((EjsNumber*) v1)->value + count);
+                CHECK; BREAK;
+            }
+            goto incExpression;
+
+        /*
+         *  Number specialized comparisons. A following conditional branch is taken directly without creating 
+         *  a boolean result.
+         *      Stack before (top)  [right]
+         *                          [left]
+         *      Stack after         [boolean]
+         */
+        CASE (EJS_OP_COMPARE_EQ_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                i = ((EjsNumber*) v1)->value == ((EjsNumber*) v2)->value;
+                goto numberCompare;
+            }
+            opcode = EJS_OP_COMPARE_EQ;
+            goto binaryExpression;
+
+        CASE (EJS_OP_COMPARE_NE_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                i = ((EjsNumber*) v1)->value != ((EjsNumber*) v2)->value;
+                goto numberCompare;
+            }
+            opcode = EJS_OP_COMPARE_NE;
+            goto binaryExpression;
+
+        CASE (EJS_OP_COMPARE_LT_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                i = ((EjsNumber*) v1)->value < ((EjsNumber*) v2)->value;
+                goto numberCompare;
+            }
+            opcode = EJS_OP_COMPARE_LT;
+            goto binaryExpression;
+
+        CASE (EJS_OP_COMPARE_LE_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                i = ((EjsNumber*) v1)->value <= ((EjsNumber*) v2)->value;
+                goto numberCompare;
+            }
+            opcode = EJS_OP_COMPARE_LE;
+            goto binaryExpression;
+
+        CASE (EJS_OP_COMPARE_GT_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                i = ((EjsNumber*) v1)->value > ((EjsNumber*) v2)->value;
+                goto numberCompare;
+            }
+            opcode = EJS_OP_COMPARE_GT;
+            goto binaryExpression;
+
+        CASE (EJS_OP_COMPARE_GE_NUM):
+            v2 = state.stack[0];
+            v1 = state.stack[-1];
+            if (likely(v1 && v2 && v1->type == ejs->numberType && v2->type == ejs->numberType)) {
+                i = ((EjsNumber*) v1)->value >= ((EjsNumber*) v2)->value;
+                goto numberCompare;
+            }
+            opcode = EJS_OP_COMPARE_GE;
+            goto binaryExpression;
+
+        numberCompare:
+            state.stack -= 2;
+            opcode = *FRAME->pc;
+            if (opcode == EJS_OP_BRANCH_TRUE_8 || opcode == EJS_OP_BRANCH_FALSE_8) {
+                FRAME->pc++;
+                offset = (schar) GET_BYTE();
+            } else if (opcode == EJS_OP_BRANCH_TRUE || opcode == EJS_OP_BRANCH_FALSE) {
+                FRAME->pc++;
+                offset = GET_WORD();
+            } else {
+                ejs->result = (EjsVar*) (i ? ejs->trueValue : ejs->falseValue);
+                push(ejs->result);
+                BREAK;
+            }
+            if (i == (opcode == EJS_OP_BRANCH_TRUE_8 || opcode == EJS_OP_BRANCH_TRUE)) {
+                FRAME->pc = &FRAME->pc[offset];
+                HEAT(offset);
+            }
+            BREAK;
+
+        /*
+         *  Increment a local variable in slot 0-9 (i++, ++i, i--). Substituted by quickenCode for the sequence:
+         *      GetLocalSlotN, Dup, Inc <increment>, PutLocalSlotN, Pop
+         *      GetLocalSlotN, Inc <increment>, Dup, PutLocalSlotN, Pop
+         *  If the variable is not a number, the sequence is run as is.
+         *      Stack before (top)  []
+         *      Stack after         []
+         */
+        CASE (EJS_OP_INC_LOCAL_SLOT):
+            pc = FRAME->pc;
+            slotNum = pc[3] - EJS_OP_PUT_LOCAL_SLOT_0;
+            v1 = GET_SLOT(FRAME, slotNum);
+            if (likely(v1 && v1->type == ejs->numberType)) {
+                count = (schar) ((pc[0] == EJS_OP_DUP) ? pc[2] : pc[1]);
+                FRAME->pc += 5;
+                SET_SLOT(FRAME, slotNum, ejsCreateNumber(ejs, ((EjsNumber*) v1)->value + count), NULL);
+                CHECK; BREAK;
+            }
+            push(v1);
+            DO_GETTER(NULL);
+            BREAK;
+
+        /*
+         *  Add or subtract an integer constant to a local variable in slot 0-9 (x = x + 1, x -= 2). Substituted by 
+         *  quickenCode for the sequence:
+         *      GetLocalSlotN, LoadInt|Load0-9|LoadM1, Add|Sub, PutLocalSlotN
+         *  If the variable is not a number, the sequence is run as is.
+         *      Stack before (top)  []
+         *      Stack after         []
+         */
+        CASE (EJS_OP_ADD_LOCAL_SLOT): {
+            MprNumber   n;
+            pc = FRAME->pc;
+            opcode = *pc++;
+            if (opcode == EJS_OP_LOAD_INT) {
+                n = (MprNumber) ejsDecodeNum(&pc);
+            } else if (opcode == EJS_OP_LOAD_M1) {
+                n = -1;
+            } else {
+                n = opcode - EJS_OP_LOAD_0;
+            }
+            opcode = *pc++;
+            if (opcode == EJS_OP_SUB || opcode == EJS_OP_SUB_NUM) {
+                n = -n;
+            }
+            slotNum = *pc++ - EJS_OP_PUT_LOCAL_SLOT_0;
+            v1 = GET_SLOT(FRAME, slotNum);
+            if (likely(v1 && v1->type == ejs->numberType)) {
+                FRAME->pc = pc;
+                SET_SLOT(FRAME, slotNum, ejsCreateNumber(ejs, ((EjsNumber*) v1)->value + n), NULL);
+                CHECK; BREAK;
+            }
+            push(v1);
+            DO_GETTER(NULL);
+            BREAK;
+        }
+
         /*
          *  Object creation
          */
@@ -2064,8 +2423,10 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
                              vp->hasGetterSetter = 1;
                         }
                     }
-                    ejsName(&qname, mprStrdup(vp, spaceVar->value), mprStrdup(vp, nameVar->value));
-                    vp->noPool = 1;
+                    /*
+                     *  Literal property names come from the module so intern rather than copy per object
+                     */
+                    ejsName(&qname, ejsInternString(ejs, spaceVar->value), ejsInternString(ejs, nameVar->value));
                     ejsSetPropertyByName(ejs, vp, &qname, v1);
                 }
             }
@@ -2250,6 +2611,7 @@ static MPR_INLINE int storePropertyToSlot(Ejs *ejs, EjsObject *obj, int slotNum,
         return 1;
     }
     if (ejsIsObject(obj) && slotNum < obj->numProp) {
+        ejsWriteBarrier(ejs, obj, value);
         obj->slots[slotNum] = value;
     } else {
         ejsSetProperty(ejs, (EjsVar*) obj, slotNum, (EjsVar*) value);
@@ -2264,7 +2626,7 @@ static MPR_INLINE int storePropertyToSlot(Ejs *ejs, EjsObject *obj, int slotNum,
 /*
  *  Store a property by name in the given object. Will create if the property does not already exist.
  */
-static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *qname, bool dup)
+static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *qname, bool dup, uchar *pc)
 {
     EjsFunction     *fun;
     EjsLookup       lookup;
@@ -2291,7 +2653,11 @@ static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *qname, bool dup)
         pushOutside(ejs, value);
     }
 
-    slotNum = ejsLookupVar(ejs, obj, qname, &lookup);
+    if (pc) {
+        slotNum = lookupCachedVar(ejs, pc, obj, qname, &lookup);
+    } else {
+        slotNum = ejsLookupVar(ejs, obj, qname, &lookup);
+    }
     if (slotNum >= 0) {
         obj = lookup.obj;
         /*
@@ -2371,12 +2737,20 @@ static void storePropertyToScope(Ejs *ejs, EjsName *qname, bool dup)
 
 
 /*
- *  Attend to unusual circumstances. Memory allocation errors, exceptions and forced exits.
+ *  Attend to unusual circumstances. Memory allocation errors, exceptions and forced exits. The profiler keeps 
+ *  attention requested while running so it can count calls and branches between samples.
  */
 static bool payAttention(Ejs *ejs)
 {
     ejs->attention = 0;
 
+    if (ejs->profiler && ejs->profiler->running) {
+        if (--ejs->profiler->countdown <= 0) {
+            ejsSampleProfiler(ejs);
+        }
+        ejs->attention = 1;
+    }
+
     if (ejs->gcRequired) {
         ejsCollectGarbage(ejs, EJS_GEN_NEW);
     }
@@ -2774,6 +3148,7 @@ static EjsBlock *popExceptionBlock(Ejs *ejs)
  */
 static bool manageExceptions(Ejs *ejs)
 {
+    EjsFrame        *fp;
     EjsState        *state;
 
     state = ejs->state;
@@ -2788,7 +3163,9 @@ static bool manageExceptions(Ejs *ejs)
         }
         state->stack = state->fp->stackReturn;
         state->bp = state->fp->function.block.prev;
-        state->fp = state->fp->caller;
+        fp = state->fp;
+        state->fp = fp->caller;
+        ejsPopFrame(ejs, fp);
     }
     return 0;
 }
@@ -3095,6 +3472,149 @@ static EjsVar *evalBinaryExpr(Ejs *ejs, EjsVar *lhs, EjsOpCode opcode, EjsVar *r
 }
 
 
+/*
+ *  Test if the result of a string concatenation is stored straight back into the local variable holding the left
+ *  hand string. ie. s += str.
+ */
+static MPR_INLINE int isLocalAppend(Ejs *ejs, EjsFrame *fp, EjsVar *lhs)
+{
+    EjsObject   *obj;
+    uchar       *pc;
+    int         opcode, slotNum;
+
+    pc = fp->pc;
+    opcode = *pc++;
+    if (EJS_OP_PUT_LOCAL_SLOT_0 <= opcode && opcode <= EJS_OP_PUT_LOCAL_SLOT_9) {
+        slotNum = opcode - EJS_OP_PUT_LOCAL_SLOT_0;
+    } else if (opcode == EJS_OP_PUT_LOCAL_SLOT) {
+        slotNum = (int) ejsDecodeNum(&pc);
+    } else {
+        return 0;
+    }
+    obj = (EjsObject*) fp;
+    return slotNum < obj->numProp && obj->slots[slotNum] == lhs;
+}
+
+
+/*
+ *  Quicken code when it is first run. The first instruction of common sequences is replaced by a superinstruction 
+ *  and generic operators that are likely to see numbers are replaced by number specialized operators. The sequences 
+ *  were chosen from opcode pair counts of the benchmarks in test/bench. Only the first byte of a sequence is 
+ *  rewritten, so the remaining instructions are intact for branches into the sequence and for the fall back path 
+ *  when operands have unexpected types. Code is not quickened while compiling or when the VM will not run it, so 
+ *  module files and listings always see the compiler's byte code.
+ */
+static void quickenCode(Ejs *ejs, EjsCode *code)
+{
+    EjsOptable  *optable;
+    uchar       *pc, *next, *end, *op;
+    int         opcode, prior, maxOp;
+
+    if (ejs->flags & (EJS_FLAG_COMPILER | EJS_FLAG_NO_EXE)) {
+        return;
+    }
+    optable = ejsGetOptable(ejs);
+    maxOp = ejsGetOpcodeCount(optable);
+    pc = code->byteCode;
+    end = &pc[code->codeLen];
+    prior = -1;
+
+    while (pc < end) {
+        opcode = *pc;
+        if ((next = ejsGetNextInstruction(optable, maxOp, pc)) == 0) {
+            break;
+        }
+        switch (opcode) {
+        case EJS_OP_GET_LOCAL_SLOT_0: case EJS_OP_GET_LOCAL_SLOT_1: case EJS_OP_GET_LOCAL_SLOT_2: 
+        case EJS_OP_GET_LOCAL_SLOT_3: case EJS_OP_GET_LOCAL_SLOT_4: case EJS_OP_GET_LOCAL_SLOT_5: 
+        case EJS_OP_GET_LOCAL_SLOT_6: case EJS_OP_GET_LOCAL_SLOT_7: case EJS_OP_GET_LOCAL_SLOT_8: 
+        case EJS_OP_GET_LOCAL_SLOT_9:
+            /*
+             *  i++ and ++i
+             */
+            if (&pc[5] < end && pc[4] == opcode - EJS_OP_GET_LOCAL_SLOT_0 + EJS_OP_PUT_LOCAL_SLOT_0 && 
+                    pc[5] == EJS_OP_POP && 
+                    ((pc[1] == EJS_OP_DUP && (pc[2] == EJS_OP_INC || pc[2] == EJS_OP_INC_NUM)) || 
+                    ((pc[1] == EJS_OP_INC || pc[1] == EJS_OP_INC_NUM) && pc[3] == EJS_OP_DUP))) {
+                *pc = EJS_OP_INC_LOCAL_SLOT;
+                break;
+            }
+            /*
+             *  x = x + constant and x = x - constant
+             */
+            op = next;
+            if (*op == EJS_OP_LOAD_INT || *op == EJS_OP_LOAD_M1 || (EJS_OP_LOAD_0 <= *op && *op <= EJS_OP_LOAD_9)) {
+                if ((op = ejsGetNextInstruction(optable, maxOp, op)) != 0 && &op[1] < end && 
+                        (*op == EJS_OP_ADD || *op == EJS_OP_SUB || *op == EJS_OP_ADD_NUM || *op == EJS_OP_SUB_NUM) &&
+                        op[1] == opcode - EJS_OP_GET_LOCAL_SLOT_0 + EJS_OP_PUT_LOCAL_SLOT_0) {
+                    *pc = EJS_OP_ADD_LOCAL_SLOT;
+                }
+            }
+            break;
+
+        case EJS_OP_COMPARE_EQ: case EJS_OP_COMPARE_NE: case EJS_OP_COMPARE_LT:
+        case EJS_OP_COMPARE_LE: case EJS_OP_COMPARE_GT: case EJS_OP_COMPARE_GE:
+            /*
+             *  The number specialized comparisons take a following branch directly
+             */
+            if (next < end && (*next == EJS_OP_BRANCH_TRUE || *next == EJS_OP_BRANCH_FALSE || 
+                    *next == EJS_OP_BRANCH_TRUE_8 || *next == EJS_OP_BRANCH_FALSE_8)) {
+                *pc = ejsGetNumberOpcode(opcode);
+            }
+            break;
+
+        case EJS_OP_ADD:
+            /*
+             *  Add is also string concatenation. The generic add tests for strings first, so only specialize 
+             *  when the right operand is a number constant.
+             */
+            if (prior == EJS_OP_LOAD_INT || prior == EJS_OP_LOAD_DOUBLE || prior == EJS_OP_LOAD_M1 ||
+                    (EJS_OP_LOAD_0 <= prior && prior <= EJS_OP_LOAD_9)) {
+                *pc = EJS_OP_ADD_NUM;
+            }
+            break;
+
+        case EJS_OP_SUB:
+        case EJS_OP_MUL:
+        case EJS_OP_DIV:
+        case EJS_OP_INC:
+            *pc = ejsGetNumberOpcode(opcode);
+            break;
+        }
+        prior = opcode;
+        pc = next;
+    }
+    code->quickened = 1;
+}
+
+
+/*
+ *  Translate hot code to use operators specialized for numbers. Instructions are rewritten in place with instructions
+ *  of the same length, so jump offsets and exception handler addresses are unchanged. The specialized instructions 
+ *  test their operands and fall back to the generic operator. This makes it safe to translate code that is currently
+ *  executing or that is shared with cloned interpreters.
+ */
+static void translateCode(Ejs *ejs, EjsCode *code)
+{
+    EjsOptable  *optable;
+    uchar       *pc, *end;
+    int         maxOp;
+
+    if (ejs->flags & EJS_FLAG_COMPILER) {
+        return;
+    }
+    optable = ejsGetOptable(ejs);
+    maxOp = ejsGetOpcodeCount(optable);
+    pc = code->byteCode;
+    end = &pc[code->codeLen];
+
+    while (pc && pc < end) {
+        *pc = ejsGetNumberOpcode(*pc);
+        pc = ejsGetNextInstruction(optable, maxOp, pc);
+    }
+}
+
+
 /*
  *  Evaluate a unary expression.
  *  OPT -- once simplified, move back inline into eval loop.
@@ -3111,6 +3631,7 @@ static EjsVar *evalUnaryExpr(Ejs *ejs, EjsVar *lhs, EjsOpCode opcode)
 int ejsInitStack(Ejs *ejs)
 {
     EjsState    *state;
+    int         size;
 
     state = ejs->state = ejs->masterState = mprAllocObjZeroed(ejs, EjsState);
 
@@ -3128,6 +3649,18 @@ int ejsInitStack(Ejs *ejs)
         return EJS_ERR;
     }
     state->stack = &state->stackBase[-1];
+
+    /*
+     *  Allocate the frame stack for function activation frames
+     */
+    size = MPR_PAGE_ALIGN(EJS_FRAME_STACK_MAX, mprGetPageSize(ejs));
+    state->framesBase = mprMapAlloc(ejs, size, MPR_MAP_READ | MPR_MAP_WRITE);
+    if (state->framesBase == 0) {
+        mprSetAllocError(ejs);
+        return EJS_ERR;
+    }
+    state->framesEnd = &state->framesBase[size];
+    state->frames = state->framesBase;
     return 0;
 }
 
@@ -3162,7 +3695,7 @@ static char *getStringArg(EjsFrame *fp)
     number = (int) ejsDecodeNum(&fp->pc);
 
     mprAssert(fp->function.body.code.constants);
-    return &fp->function.body.code.constants->pool[number];
+    return ejsGetConstString(fp->function.body.code.constants, number);
 }
 
 
@@ -3201,7 +3734,7 @@ static EjsVar *getGlobalArg(Ejs *ejs, EjsFrame *fp)
         break;
 
     case EJS_ENCODE_GLOBAL_NAME:
-        qname.name = &fp->function.body.code.constants->pool[t >> 2];
+        qname.name = ejsGetConstString(fp->function.body.code.constants, t >> 2);
         if (qname.name == 0) {
             mprAssert(0);
             return 0;
@@ -3322,7 +3855,13 @@ static void callFunction(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc,
         state->stack -= (argc + stackAdjust);
 
     } else {
-        fp = ejsCreateFrame(ejs, fun);
+        if (unlikely(!fun->body.code.quickened)) {
+            quickenCode(ejs, &fun->body.code);
+        }
+        if (unlikely(ejs->flags & EJS_FLAG_JIT) && ++fun->body.code.heat == EJS_JIT_THRESHOLD) {
+            translateCode(ejs, &fun->body.code);
+        }
+        fp = ejsPushFrame(ejs, fun);
         fp->function.block.prev = state->bp;
         fp->function.thisObj = thisObj;
         fp->caller = state->fp;
@@ -3331,6 +3870,7 @@ static void callFunction(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc,
         if (argc > 0) {
             fp->argc = argc;
             if ((uint) argc < (fun->numArgs - fun->numDefault) || (uint) argc > fun->numArgs) {
+                ejsPopFrame(ejs, fp);
                 ejsThrowArgError(ejs, "Incorrect number of arguments");
                 return;
             }
@@ -3414,6 +3954,279 @@ static MPR_INLINE EjsVar *getNthBlock(Ejs *ejs, int nth)
 }
 
 
+/******************************** Inline Caches *******************************/
+/*
+ *  Property lookups by name (GET/PUT/CALL_OBJ_NAME) are cached per instruction. Byte code is shared by cloned
+ *  interpreters, so rather than patching the instruction stream, each interpreter keeps a direct mapped table of
+ *  cache sites keyed by instruction address. Each site records up to EJS_CACHE_WAYS receiver shapes. A shape is
+ *  the receiver type and (for objects) its names table. Shapes change when names are added to an object that
+ *  shares its type's names (the object gets its own names) or when a type changes, which resets the cache epoch.
+ */
+#define EJS_IC_NONE     0               /* Receiver can't be cached */
+#define EJS_IC_OBJECT   1               /* Receiver uses the standard object property lookup */
+#define EJS_IC_OPAQUE   2               /* Receiver can never own the property. Search always starts at the type */
+
+#define SAME_STR(a, b)  ((a) == (b) || strcmp(a, b) == 0)
+
+static EjsInlineCache *createInlineCache(Ejs *ejs)
+{
+    EjsInlineCache  *ic;
+
+    if ((ic = mprAllocObjZeroed(ejs, EjsInlineCache)) == 0) {
+        return 0;
+    }
+    ic->size = EJS_INLINE_CACHE_SIZE;
+    if ((ic->sites = (EjsCacheSite*) mprAllocZeroed(ic, ic->size * sizeof(EjsCacheSite))) == 0) {
+        mprFree(ic);
+        return 0;
+    }
+    ejs->inlineCache = ic;
+    return ic;
+}
+
+
+/*
+ *  Invalidate all inline cache entries. Called when type or shared instance names change.
+ */
+void ejsResetInlineCache(Ejs *ejs)
+{
+    if (ejs->inlineCache) {
+        ejs->inlineCache->epoch++;
+    }
+}
+
+
+/*
+ *  Classify how the receiver participates in property lookup
+ */
+static MPR_INLINE int getReceiverKind(Ejs *ejs, EjsVar *vp, EjsName *qname)
+{
+    EjsLookupPropertyHelper     lookup;
+
+    lookup = vp->type->helpers->lookupProperty;
+    if (lookup == ejs->objectHelpers->lookupProperty) {
+        return EJS_IC_OBJECT;
+    } else if (lookup == ejs->defaultHelpers->lookupProperty) {
+        return EJS_IC_OPAQUE;
+    } else if ((vp->type == ejs->stringType || vp->type == ejs->arrayType) && !isdigit((int) qname->name[0])) {
+        /*
+         *  Strings and arrays only resolve numeric indicies themselves
+         */
+        return EJS_IC_OPAQUE;
+    }
+    return EJS_IC_NONE;
+}
+
+
+/*
+ *  Test if an object is using shared names (its type's instance names or a shape). Such objects can't gain 
+ *  properties without getting a new names table.
+ */
+static MPR_INLINE int sharesTypeNames(EjsObject *obj)
+{
+    EjsBlock    *instanceBlock;
+
+    if (obj->names == 0 || obj->names->shared) {
+        return 1;
+    }
+    instanceBlock = obj->var.type->instanceBlock;
+    return instanceBlock && obj->names == instanceBlock->obj.names;
+}
+
+
+static void claimSite(Ejs *ejs, EjsInlineCache *ic, EjsCacheSite *site, uchar *pc, EjsName *qname)
+{
+    EjsFrame    *fp;
+    cchar       *name;
+
+    if (site->pc) {
+        ic->evictions++;
+    }
+    memset(site, 0, sizeof(EjsCacheSite));
+    site->pc = pc;
+    site->name = qname->name;
+    site->space = qname->space;
+    site->epoch = ic->epoch;
+
+    name = "global";
+    fp = ejs->state->fp;
+    if (fp && fp->function.owner && fp->function.slotNum >= 0) {
+        /*
+         *  Read the owner's names directly. Function owners otherwise redirect to their Function.* properties.
+         */
+        name = (ejs->objectHelpers->getPropertyName)(ejs, fp->function.owner, fp->function.slotNum).name;
+    }
+    mprStrcpy(site->function, sizeof(site->function), name ? name : "");
+}
+
+
+/*
+ *  Record where a property was found. The owner must use standard object property storage so the slot and name can 
+ *  be revalidated on each hit.
+ */
+static void addCacheEntry(Ejs *ejs, EjsCacheSite *site, EjsVar *vp, int kind, EjsLookup *lookup)
+{
+    EjsCacheEntry   *ep;
+    EjsObject       *owner, *obj;
+
+    if (site->numEntries >= EJS_CACHE_WAYS) {
+        site->megamorphic = 1;
+        return;
+    }
+    owner = (EjsObject*) lookup->obj;
+    if (owner->var.type->helpers->lookupProperty != ejs->objectHelpers->lookupProperty || owner->names == 0) {
+        return;
+    }
+    obj = (EjsObject*) vp;
+    if ((EjsVar*) owner == vp) {
+        /*
+         *  Objects that own their names can gain properties in place. Only exact matches can't be shadowed later.
+         */
+        if (kind != EJS_IC_OBJECT || (!sharesTypeNames(obj) && !SAME_STR(lookup->name.space, site->space))) {
+            return;
+        }
+    } else if (vp->isType || (kind == EJS_IC_OBJECT && !sharesTypeNames(obj))) {
+        return;
+    }
+    ep = &site->entries[site->numEntries++];
+    ep->type = vp->type;
+    ep->names = (kind == EJS_IC_OBJECT) ? obj->names : 0;
+    ep->owner = ((EjsVar*) owner == vp) ? 0 : (EjsVar*) owner;
+    ep->space = lookup->name.space;
+    ep->slotNum = lookup->slotNum;
+    ep->nthBase = lookup->nthBase;
+}
+
+
+/*
+ *  Find a property in an object or its base types using the inline cache for the instruction at pc. 
+ *  Returns the slot number and sets lookup->obj, or -1 if the property can't be found.
+ */
+static int lookupCachedVar(Ejs *ejs, uchar *pc, EjsVar *vp, EjsName *qname, EjsLookup *lookup)
+{
+    EjsInlineCache  *ic;
+    EjsCacheSite    *site;
+    EjsCacheEntry   *ep;
+    EjsObject       *owner;
+    EjsName         *np;
+    int             i, kind, slotNum;
+
+    if ((ic = ejs->inlineCache) == 0 && (ic = createInlineCache(ejs)) == 0) {
+        return ejsLookupVar(ejs, vp, qname, lookup);
+    }
+    site = &ic->sites[(((size_t) pc) ^ (((size_t) pc) >> 10)) & (ic->size - 1)];
+    if (site->pc != pc || site->name != qname->name || site->space != qname->space) {
+        claimSite(ejs, ic, site, pc, qname);
+    } else if (site->epoch != ic->epoch) {
+        site->epoch = ic->epoch;
+        site->numEntries = 0;
+        site->megamorphic = 0;
+    }
+    if (site->megamorphic || (kind = getReceiverKind(ejs, vp, qname)) == EJS_IC_NONE) {
+        ic->megamorphic += site->megamorphic;
+        site->misses++;
+        ic->misses++;
+        return ejsLookupVar(ejs, vp, qname, lookup);
+    }
+    for (i = 0; i < site->numEntries; i++) {
+        ep = &site->entries[i];
+        if (ep->type != vp->type) {
+            continue;
+        }
+        if (kind == EJS_IC_OBJECT && ep->names != ((EjsObject*) vp)->names) {
+            continue;
+        }
+        owner = (EjsObject*) (ep->owner ? ep->owner : vp);
+        slotNum = ep->slotNum;
+        if (slotNum >= owner->numProp || owner->names == 0 || slotNum >= owner->names->sizeEntries) {
+            continue;
+        }
+        np = &owner->names->entries[slotNum].qname;
+        if (np->name == 0 || !SAME_STR(np->name, qname->name) || !SAME_STR(np->space, ep->space)) {
+            continue;
+        }
+        site->hits++;
+        ic->hits++;
+        lookup->obj = (EjsVar*) owner;
+        lookup->name = *np;
+        lookup->nthBase = ep->nthBase;
+        lookup->nthBlock = 0;
+        lookup->useThis = 0;
+        lookup->instanceProperty = 0;
+        lookup->ownerIsType = 0;
+        return lookup->slotNum = slotNum;
+    }
+    site->misses++;
+    ic->misses++;
+    if ((slotNum = ejsLookupVar(ejs, vp, qname, lookup)) >= 0) {
+        addCacheEntry(ejs, site, vp, kind, lookup);
+    }
+    return slotNum;
+}
+
+
+typedef struct CacheStats {
+    uint    hits;
+    uint    misses;
+    int     sites;
+    int     megamorphic;
+} CacheStats;
+
+/*
+ *  Print inline cache hit rates per function
+ */
+void ejsPrintInlineCacheReport(Ejs *ejs)
+{
+    EjsInlineCache  *ic;
+    EjsCacheSite    *site;
+    MprHashTable    *table;
+    MprHash         *hp;
+    CacheStats      *stats;
+    uint            total;
+    int             i, used;
+
+    if ((ic = ejs->inlineCache) == 0) {
+        return;
+    }
+    if ((table = mprCreateHash(ic, 0)) == 0) {
+        return;
+    }
+    used = 0;
+    for (i = 0; i < ic->size; i++) {
+        site = &ic->sites[i];
+        if (site->pc == 0) {
+            continue;
+        }
+        used++;
+        if ((stats = (CacheStats*) mprLookupHash(table, site->function)) == 0) {
+            if ((stats = mprAllocObjZeroed(table, CacheStats)) == 0) {
+                break;
+            }
+            mprAddHash(table, site->function, stats);
+        }
+        stats->hits += site->hits;
+        stats->misses += site->misses;
+        stats->sites++;
+        stats->megamorphic += site->megamorphic;
+    }
+    total = ic->hits + ic->misses;
+    mprLog(ejs, 0, "\nInline Cache Statistics");
+    mprLog(ejs, 0, "------------------------");
+    mprLog(ejs, 0, "  Sites used             %,14d of %d", used, ic->size);
+    mprLog(ejs, 0, "  Lookups                %,14d", total);
+    mprLog(ejs, 0, "  Hits                   %,14d (%d%%)", ic->hits, total ? (int) ((ic->hits * 100.0) / total) : 0);
+    mprLog(ejs, 0, "  Megamorphic lookups    %,14d", ic->megamorphic);
+    mprLog(ejs, 0, "  Site evictions         %,14d", ic->evictions);
+    mprLog(ejs, 0, "\nFunction                          Sites  Megamorphic        Hits      Misses");
+    for (hp = mprGetFirstHash(table); hp; hp = mprGetNextHash(table, hp)) {
+        stats = (CacheStats*) hp->data;
+        mprLog(ejs, 0, "%-32s %,6d %,12d %,11d %,11d", hp->key, stats->sites, stats->megamorphic, stats->hits, 
+            stats->misses);
+    }
+    mprFree(table);
+}
+
+
 /*
  *  Enter a mesage into the log file
  */
@@ -3440,18 +4253,160 @@ void ejsShowStack(Ejs *ejs, EjsFunction *fp)
 }
 
 
-#if BLD_DEBUG
+#if BLD_FEATURE_EJS_OPSTATS
+/*
+ *  Read the CPU cycle counter
+ */
+static MPR_INLINE uint64 getCycles()
+{
+#if (BLD_HOST_CPU_ARCH == MPR_CPU_IX86 || BLD_HOST_CPU_ARCH == MPR_CPU_IX64) && __GNUC__
+    uint    lo, hi;
+
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return (((uint64) hi) << 32) | lo;
+#else
+    return mprGetTicks();
+#endif
+}
+
+
+/*
+ *  Count an opcode and the pair it forms with the prior opcode. Every EJS_OPSTATS_SAMPLE instructions, time the 
+ *  instruction by reading the cycle counter here and again at the next dispatch. Counts are shared by all interpreters 
+ *  and are not locked, so they are approximate when several interpreters run at once.
+ */
+static void countOpcode(Ejs *ejs, EjsOpCode opcode)
+{
+    EjsOpStats  *stats;
+    uint64      now;
+
+    if ((stats = ejs->service->opStats) == 0) {
+        return;
+    }
+    if (ejs->timedOp >= 0) {
+        now = getCycles();
+        stats->cycles[ejs->timedOp] += now - ejs->timedStart;
+        stats->timed[ejs->timedOp]++;
+        ejs->timedOp = -1;
+    }
+    stats->counts[opcode]++;
+    if (ejs->lastOp >= 0) {
+        stats->pairs[ejs->lastOp][opcode]++;
+    }
+    ejs->lastOp = opcode;
+    if (++ejs->opCountdown >= EJS_OPSTATS_SAMPLE) {
+        ejs->opCountdown = 0;
+        ejs->timedOp = opcode;
+        ejs->timedStart = getCycles();
+    }
+}
+
+
+typedef struct OpCount {
+    uint64      count;
+    int         op;
+    int         next;
+} OpCount;
+
+
+static int compareOpCounts(const void *a, const void *b)
+{
+    uint64  ac, bc;
+
+    ac = ((OpCount*) a)->count;
+    bc = ((OpCount*) b)->count;
+    return (ac < bc) ? 1 : ((ac > bc) ? -1 : 0);
+}
+#endif
+
+
+/*
+ *  Print opcode and opcode pair execution counts with the average cycles per opcode. Requires a build with 
+ *  BLD_FEATURE_EJS_OPSTATS.
+ */
+void ejsPrintOpStats(Ejs *ejs)
+{
+#if BLD_FEATURE_EJS_OPSTATS
+    EjsOpStats      *stats;
+    EjsOptable      *optable;
+    OpCount         *list, *oc;
+    uint64          total;
+    int             i, j, n;
+
+    if ((stats = ejs->service->opStats) == 0) {
+        return;
+    }
+    if ((list = (OpCount*) mprAlloc(ejs, 256 * 256 * sizeof(OpCount))) == 0) {
+        return;
+    }
+    optable = ejsGetOptable(ejs);
+    total = 0;
+    for (n = i = 0; i < 256; i++) {
+        if (stats->counts[i]) {
+            oc = &list[n++];
+            oc->count = stats->counts[i];
+            oc->op = i;
+            total += oc->count;
+        }
+    }
+    qsort(list, n, sizeof(OpCount), compareOpCounts);
+
+    mprLog(ejs, 0, "\nOpcode Statistics");
+    mprLog(ejs, 0, "-----------------");
+    mprLog(ejs, 0, "  Instructions           %,14Ld", total);
+    mprLog(ejs, 0, "  Timed instructions     1 in %d", EJS_OPSTATS_SAMPLE);
+    mprLog(ejs, 0, "\nOpcode                                Count       %%   Avg Cycles");
+    for (i = 0; i < n; i++) {
+        oc = &list[i];
+        mprLog(ejs, 0, "%-28s %,14Ld %7.2f %12.1f", optable[oc->op].name, oc->count, oc->count * 100.0 / total,
+            stats->timed[oc->op] ? ((double) stats->cycles[oc->op] / stats->timed[oc->op]) : 0.0);
+    }
+
+    total = 0;
+    for (n = i = 0; i < 256; i++) {
+        for (j = 0; j < 256; j++) {
+            if (stats->pairs[i][j]) {
+                oc = &list[n++];
+                oc->count = stats->pairs[i][j];
+                oc->op = i;
+                oc->next = j;
+                total += oc->count;
+            }
+        }
+    }
+    qsort(list, n, sizeof(OpCount), compareOpCounts);
+
+    mprLog(ejs, 0, "\nOpcode Pair                                                       Count       %%");
+    for (i = 0; i < n && i < EJS_OPSTATS_PAIRS; i++) {
+        oc = &list[i];
+        mprLog(ejs, 0, "%-28s %-28s %,14Ld %7.2f", optable[oc->op].name, optable[oc->next].name, oc->count, 
+            oc->count * 100.0 / total);
+    }
+    mprFree(list);
+#else
+    mprLog(ejs, 0, "Opcode statistics require a build with BLD_FEATURE_EJS_OPSTATS");
+#endif
+}
+
+
+#if BLD_DEBUG || BLD_FEATURE_EJS_OPSTATS
 
 int ejsOpCount = 0;
 static EjsOpCode traceCode(Ejs *ejs, EjsOpCode opcode)
 {
+#if BLD_DEBUG
     EjsFrame        *fp;
     EjsState        *state;
     EjsOptable      *optable;
     int             len;
     static int      once = 0;
     static int      stop = 1;
+#endif
 
+#if BLD_FEATURE_EJS_OPSTATS
+    countOpcode(ejs, opcode);
+#endif
+#if BLD_DEBUG
     state = ejs->state;
     fp = state->fp;
     opcount[opcode]++;
@@ -3472,6 +4427,7 @@ static EjsOpCode traceCode(Ejs *ejs, EjsOpCode opcode)
             mprSleep(ejs, 0);
         }
     }
+#endif
     ejsOpCount++;
     return opcode;
 }
@@ -307,6 +307,10 @@ static int loadSections(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int flags)
 
         if (rc < 0) {
             if (mp && mp->name && created) {
+                if (mp->constants->pool) {
+                    /* Interned names may still reference the constant pool */
+                    mprStealBlock(ejs, mp->constants->pool);
+                }
                 ejsRemoveModule(ejs, mp);
                 mprRemoveItem(ejs->loadState->modules, mp);
                 mprFree(mp);
@@ -1542,7 +1546,7 @@ static char *tokenToString(EjsModule *mp, int token)
         mprAssert(0);
         return 0;
     }
-    return &mp->constants->pool[token];
+    return ejsGetConstString(mp->constants, token);
 }
 
 
@@ -8,6 +8,12 @@
 
 #include    "ejs.h"
 
+/****************************** Forward Declarations **************************/
+
+static int internConstants(Ejs *ejs, EjsConst *constants);
+
+#define ATOM_HASH(token, mask) ((int) (((uint) (token) * 2654435761U) >> 7) & (mask))
+
 /******************************************************************************/
 
 EjsModule *ejsCreateModule(Ejs *ejs, cchar *name, int version)
@@ -44,10 +50,72 @@ int ejsSetModuleConstants(Ejs *ejs, EjsModule *mp, cchar *pool, int poolSize)
     mp->constants->pool = (char*) pool;
     mp->constants->size = poolSize;
     mp->constants->len = poolSize;
+    return internConstants(ejs, mp->constants);
+}
+
+
+/*
+ *  Intern the short strings in a constant pool. Names read by the loader and by the interpreter are then the unique
+ *  interpreter-wide copies so property name comparisons usually succeed on the pointer test without a strcmp.
+ *  The interned strings are indexed by pool offset (the token used in the byte code) via a small open hash.
+ */
+static int internConstants(Ejs *ejs, EjsConst *constants)
+{
+    cchar   *pool, *str;
+    int     offset, len, count, size, index;
+
+    pool = constants->pool;
+    for (count = 0, offset = 0; offset < constants->len; offset += len + 1) {
+        len = (int) strlen(&pool[offset]);
+        if (len <= EJS_MAX_ATOM_LEN) {
+            count++;
+        }
+    }
+    for (size = 8; size < (count * 2); size <<= 1) ;
+
+    constants->atomTokens = (int*) mprAlloc(constants, size * (int) sizeof(int));
+    constants->atoms = (cchar**) mprAlloc(constants, size * (int) sizeof(cchar*));
+    if (constants->atomTokens == 0 || constants->atoms == 0) {
+        return EJS_ERR;
+    }
+    memset(constants->atomTokens, -1, size * sizeof(int));
+
+    for (offset = 0; offset < constants->len; offset += len + 1) {
+        str = &pool[offset];
+        len = (int) strlen(str);
+        if (len <= EJS_MAX_ATOM_LEN) {
+            for (index = ATOM_HASH(offset, size - 1); constants->atomTokens[index] >= 0; index = (index + 1) & (size - 1)) ;
+            constants->atomTokens[index] = offset;
+            constants->atoms[index] = ejsInternConstant(ejs, str);
+        }
+    }
+    constants->atomMask = size - 1;
     return 0;
 }
 
 
+/*
+ *  Map a constant pool token to its string. Returns the interned copy if one exists.
+ */
+char *ejsGetConstString(EjsConst *constants, int token)
+{
+    int     index, tok;
+
+    mprAssert(constants);
+    mprAssert(0 <= token && token < constants->len);
+
+    if (constants->atomTokens) {
+        for (index = ATOM_HASH(token, constants->atomMask); (tok = constants->atomTokens[index]) >= 0; 
+                index = (index + 1) & constants->atomMask) {
+            if (tok == token) {
+                return (char*) constants->atoms[index];
+            }
+        }
+    }
+    return &constants->pool[token];
+}
+
+
 /*
  *  Lookup a module name in the set of loaded modules
  *  If minVersion is <= 0, then any version up to, but not including maxVersion is acceptable.
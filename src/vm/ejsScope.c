@@ -18,6 +18,17 @@
  *  namespaces will be used. The lookup structure will contain details about the location of the variable.
  */
 int ejsLookupScope(Ejs *ejs, EjsName *name, EjsLookup *lookup)
+{
+    return ejsLookupOuterScope(ejs, name, 0, lookup);
+}
+
+
+/*
+ *  Look for a variable by name in the scope chain after skipping the given number of inner blocks. The compiler 
+ *  computes "depth" as the count of enclosing function and let blocks that can't define the name. Hidden blocks are 
+ *  not counted, matching the nth block operand of GetBlockSlot. The last scope chain entry (global) is never skipped.
+ */
+int ejsLookupOuterScope(Ejs *ejs, EjsName *name, int depth, EjsLookup *lookup)
 {
     EjsFrame        *fp;
     EjsBlock        *block;
@@ -27,17 +38,25 @@ int ejsLookupScope(Ejs *ejs, EjsName *name, EjsLookup *lookup)
     mprAssert(ejs);
     mprAssert(name);
     mprAssert(lookup);
+    mprAssert(depth >= 0);
 
     slotNum = -1;
     state = ejs->state;
     fp = state->fp;
 
+    for (nth = 0, block = state->bp; depth > 0 && block->scopeChain; block = block->scopeChain) {
+        if (!block->obj.var.hidden) {
+            depth--;
+        }
+        nth++;
+    }
+
     /*
      *  Look for the name in the scope chain considering each block scope. LookupVar will consider base classes and 
      *  namespaces. Don't search the last scope chain entry which will be global. For cloned interpreters, global 
      *  will belong to the master interpreter, so we must do that explicitly below to get the right global.
      */
-    for (nth = 0, block = state->bp; block->scopeChain; block = block->scopeChain) {
+    for (; block->scopeChain; block = block->scopeChain) {
 
         if (fp->function.thisObj && block == (EjsBlock*) fp->function.thisObj->type) {
             /*
@@ -105,6 +124,35 @@ int ejsLookupVar(Ejs *ejs, EjsVar *vp, EjsName *name, EjsLookup *lookup)
 }
 
 
+/*
+ *  Test if a namespace is open in the current scope chain. Protected namespaces are only visible to methods of 
+ *  the type containing the property or its sub classes.
+ */
+static bool isNamespaceOpen(Ejs *ejs, EjsVar *vp, cchar *space)
+{
+    EjsNamespace    *nsp;
+    EjsBlock        *b;
+    EjsVar          *owner;
+    int             nextNsp;
+
+    for (b = ejs->state->bp; b; b = b->scopeChain) {
+        for (nextNsp = -1; (nsp = (EjsNamespace*) ejsGetPrevItem(&b->namespaces, &nextNsp)) != 0; ) {
+            if (nsp->uri != space && (nsp->uri[0] != space[0] || strcmp(nsp->uri, space) != 0)) {
+                continue;
+            }
+            if (nsp->flags & EJS_NSP_PROTECTED && vp->isType && ejs->state->fp) {
+                owner = (EjsVar*) ejs->state->fp->function.owner;
+                if (owner && !ejsIsA(ejs, owner, (EjsType*) vp)) {
+                    continue;
+                }
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
 /*
  *  Find a variable in a block. Scope blocks are provided by the global object, types, functions and statement blocks.
  */
@@ -132,6 +180,27 @@ int ejsLookupVarWithNamespaces(Ejs *ejs, EjsVar *vp, EjsName *name, EjsLookup *l
         return slotNum;
     }
 
+    if (vp->type->helpers->lookupProperty == ejs->objectHelpers->lookupProperty || 
+            (ejsIsFunction(vp) && ((EjsFunction*) vp)->isFrame)) {
+        /*
+         *  Property hashes ignore the namespace, so one probe finds every property of this name. Only probe per 
+         *  namespace if the name is defined in more than one namespace.
+         */
+        slotNum = ejsLookupSingleProperty(ejs, (EjsObject*) vp, name);
+        if (slotNum < 0 && slotNum != -2) {
+            return -1;
+        } else if (slotNum >= 0) {
+            qname = ((EjsObject*) vp)->names->entries[slotNum].qname;
+            if (!isNamespaceOpen(ejs, vp, qname.space)) {
+                return -1;
+            }
+            lookup->name = qname;
+            lookup->obj = vp;
+            lookup->slotNum = slotNum;
+            return slotNum;
+        }
+    }
+
     slotNum = -1;
     qname = *name;
     for (b = ejs->state->bp; b; b = b->scopeChain) {
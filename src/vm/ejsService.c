@@ -20,6 +20,8 @@ static int  configureEjsModule(Ejs *ejs, EjsModule *mp, cchar *path);
 static int  defineTypes(Ejs *ejs);
 static void defineHelpers(Ejs *ejs);
 static int  destroyEjs(Ejs *ejs);
+static EjsShape *getGlobalShape(Ejs *master, int count);
+static void releaseGlobalShape(Ejs *ejs);
 static int  runSpecificMethod(Ejs *ejs, cchar *className, cchar *methodName);
 static int  searchForMethod(Ejs *ejs, cchar *methodName, EjsType **typeReturn);
 static void setDefaultSearchPath(Ejs *ejs);
@@ -52,6 +54,9 @@ EjsService *ejsCreateService(MprCtx ctx)
     }
     mprGetMpr(ctx)->ejsService = sp;
     sp->nativeModules = mprCreateHash(sp, 0);
+#if BLD_FEATURE_EJS_OPSTATS
+    sp->opStats = mprAllocObjZeroed(sp, EjsOpStats);
+#endif
 
     /*
      *  The native module callbacks are invoked after loading the module files. This allows the callback routines 
@@ -87,6 +92,10 @@ Ejs *ejsCreate(MprCtx ctx, Ejs *master, cchar *searchPath, int flags)
     }
     mprSetAllocNotifier(ejs, (MprAllocNotifier) allocNotifier);
     ejs->service = mprGetMpr(ctx)->ejsService;
+#if BLD_FEATURE_EJS_OPSTATS
+    ejs->timedOp = -1;
+    ejs->lastOp = -1;
+#endif
 
     /*
      *  Probably not necessary, but it keeps the objects in one place
@@ -97,8 +106,14 @@ Ejs *ejsCreate(MprCtx ctx, Ejs *master, cchar *searchPath, int flags)
      *  Flags may include COMPILER to pretend to be compiling. Ejsmod uses this to allow compiler-style access to
      *  getters and setters.
      */
-    ejs->flags |= (flags & (EJS_FLAG_EMPTY | EJS_FLAG_COMPILER | EJS_FLAG_NO_EXE | EJS_FLAG_DOC));
+    ejs->flags |= (flags & (EJS_FLAG_EMPTY | EJS_FLAG_COMPILER | EJS_FLAG_NO_EXE | EJS_FLAG_DOC | EJS_FLAG_JIT));
     ejs->dispatcher = mprCreateDispatcher(ejs);
+#if BLD_FEATURE_MULTITHREAD
+    /*
+     *  Created early as interning names takes the lock
+     */
+    ejs->mutex = mprCreateLock(ejs);
+#endif
 
     if (ejsInitStack(ejs) < 0) {
         mprFree(ejs);
@@ -135,10 +150,6 @@ Ejs *ejsCreate(MprCtx ctx, Ejs *master, cchar *searchPath, int flags)
         cloneMaster(ejs, master);
     }
 
-#if BLD_FEATURE_MULTITHREAD
-    ejs->mutex = mprCreateLock(ejs);
-#endif
-
     if (mprHasAllocError(ejs)) {
         mprError(ejs, "Memory allocation error during initialization");
         mprFree(ejs);
@@ -156,10 +167,16 @@ static int destroyEjs(Ejs *ejs)
     EjsState    *state;
 
     ejsDestroyGCService(ejs);
+    if (ejs->master) {
+        releaseGlobalShape(ejs);
+    }
     state = ejs->masterState;
     if (state->stackBase) {
         mprMapFree(state->stackBase, state->stackSize);
     }
+    if (state->framesBase) {
+        mprMapFree(state->framesBase, (int) (state->framesEnd - state->framesBase));
+    }
     mprFree(ejs->heap);
     return 0;
 }
@@ -223,6 +240,7 @@ static int createTypes(Ejs *ejs)
     ejsCreateConfigType(ejs);
     ejsCreateGCType(ejs);
     ejsCreateMemoryType(ejs);
+    ejsCreateProfilerType(ejs);
     ejsCreateSystemType(ejs);
     ejsCreateTimerType(ejs);
     ejsCreateFileType(ejs);
@@ -290,6 +308,7 @@ static int configureEjsModule(Ejs *ejs, EjsModule *mp, cchar *path)
 #endif
     ejsConfigureGCType(ejs);
     ejsConfigureMemoryType(ejs);
+    ejsConfigureProfilerType(ejs);
     ejsConfigureSystemType(ejs);
     ejsConfigureTimerType(ejs);
     ejsConfigurePathType(ejs);
@@ -432,6 +451,8 @@ static int cloneMaster(Ejs *ejs, Ejs *master)
     EjsType     *type;
     EjsVar      *vp;
     EjsTrait    *trait;
+    EjsBlock    *src, *dest;
+    EjsShape    *shape;
     int         i, count;
 
     mprAssert(master);
@@ -474,6 +495,7 @@ static int cloneMaster(Ejs *ejs, Ejs *master)
     ejs->infinityValue = master->infinityValue;
     ejs->minusOneValue = master->minusOneValue;
     ejs->nanValue = master->nanValue;
+    ejs->numberCache = master->numberCache;
     ejs->negativeInfinityValue = master->negativeInfinityValue;
     ejs->nullValue = master->nullValue;
     ejs->oneValue = master->oneValue;
@@ -509,16 +531,34 @@ static int cloneMaster(Ejs *ejs, Ejs *master)
     ejsCopyList(ejs->globalBlock, &ejs->globalBlock->namespaces, &master->globalBlock->namespaces);
 
     count = ejsGetPropertyCount(master, master->global);
-    // count = ES_global_NUM_CLASS_PROP;
-    for (i = 0; i < count; i++) {
-        vp = ejsGetProperty(ejs, master->global, i);
-        if (vp) {
-            ejsSetProperty(ejs, ejs->global, i, ejsGetProperty(master, master->global, i));
-            qname = ejsGetPropertyName(master, master->global, i);
-            ejsSetPropertyName(ejs, ejs->global, i, &qname);
-            trait = ejsGetTrait(master->globalBlock, i);
-            if (trait) {
-                ejsSetTrait(ejs->globalBlock, i, trait->type, trait->attributes);
+    if ((shape = getGlobalShape(master, count)) != 0) {
+        /*
+         *  Share a frozen snapshot of the master's global names. The names are copied on the first write.
+         */
+        src = master->globalBlock;
+        dest = ejs->globalBlock;
+        for (i = 0; i < count; i++) {
+            if (src->obj.slots[i]) {
+                dest->obj.slots[i] = src->obj.slots[i];
+            }
+        }
+        if (src->numTraits > 0) {
+            memcpy(dest->traits, src->traits, min(src->numTraits, dest->sizeTraits) * sizeof(EjsTrait));
+        }
+        dest->obj.names = &shape->names;
+        ejs->globalShape = shape;
+
+    } else {
+        for (i = 0; i < count; i++) {
+            vp = ejsGetProperty(ejs, master->global, i);
+            if (vp) {
+                ejsSetProperty(ejs, ejs->global, i, ejsGetProperty(master, master->global, i));
+                qname = ejsGetPropertyName(master, master->global, i);
+                ejsSetPropertyName(ejs, ejs->global, i, &qname);
+                trait = ejsGetTrait(master->globalBlock, i);
+                if (trait) {
+                    ejsSetTrait(ejs->globalBlock, i, trait->type, trait->attributes);
+                }
             }
         }
     }
@@ -564,6 +604,54 @@ static int cloneMaster(Ejs *ejs, Ejs *master)
 }
 
 
+/*
+ *  Get the snapshot of the master's global names. The snapshot is rebuilt if the master's global names have changed 
+ *  since it was taken. Superseded snapshots are freed once no cloned interpreter was created with them.
+ */
+static EjsShape *getGlobalShape(Ejs *master, int count)
+{
+    EjsShape    *shape, *prior;
+
+    ejsLockVm(master);
+    shape = prior = master->globalShape;
+    if (shape == 0 || shape->generation != master->globalGeneration || shape->numProp != count) {
+        if ((shape = ejsCreateSnapshotShape(master, (EjsObject*) master->global)) != 0) {
+            shape->generation = master->globalGeneration;
+            master->globalShape = shape;
+            if (prior && prior->refs == 0) {
+                mprFree(prior);
+            }
+        }
+    }
+    if (shape) {
+        shape->refs++;
+    }
+    ejsUnlockVm(master);
+    return shape;
+}
+
+
+/*
+ *  Release a cloned interpreter's reference to the master's global names snapshot
+ */
+static void releaseGlobalShape(Ejs *ejs)
+{
+    EjsShape    *shape;
+    Ejs         *master;
+
+    if ((shape = ejs->globalShape) == 0) {
+        return;
+    }
+    ejs->globalShape = 0;
+    master = shape->ejs;
+    ejsLockVm(master);
+    if (--shape->refs == 0 && shape != master->globalShape) {
+        mprFree(shape);
+    }
+    ejsUnlockVm(master);
+}
+
+
 /*
  *  Notifier callback function. Invoked by mprAlloc on allocation errors. This will prevent the allocation error
  *  bubbling up to the global memory failure handler.
@@ -13,6 +13,9 @@
 static EjsVar *getProperty(Ejs *ejs, EjsVar *vp, int slotNum);
 static MprNumber parseNumber(Ejs *ejs, cchar *str);
 static bool      parseBoolean(Ejs *ejs, cchar *s);
+static int       growAtoms(Ejs *ejs, EjsAtoms *atoms);
+static cchar     *intern(Ejs *ejs, cchar *str, int dup);
+static cchar     *lookupAtom(EjsAtoms *atoms, cchar *str, int *index);
 
 /*
     Get the type owning a property
@@ -434,28 +437,7 @@ EjsBoolean *ejsToBoolean(Ejs *ejs, EjsVar *vp)
  */
 EjsString *ejsToJson(Ejs *ejs, EjsVar *vp)
 {
-    EjsFunction     *fn;
-    EjsString       *result;
-
-    if (vp == 0) {
-        return ejsCreateString(ejs, "undefined");
-    }
-    if (vp->jsonVisited) {
-        return ejsCreateString(ejs, "this");
-    }
-    vp->jsonVisited = 1;
-
-    /*
-     *  Types can provide a toJSON method, a serializeVar helper. If neither are provided, toString is used as a fall-back.
-     */
-    fn = (EjsFunction*) ejsGetProperty(ejs, (EjsVar*) vp->type, ES_Object_toJSON);
-    if (ejsIsFunction(fn)) {
-        result = (EjsString*) ejsRunFunction(ejs, fn, vp, 0, NULL);
-    } else {
-        result = ejsToString(ejs, vp);
-    }
-    vp->jsonVisited = 0;
-    return result;
+    return (EjsString*) ejsSerialize(ejs, vp, 0, EJS_FLAGS_PRETTY);
 }
 
 
@@ -512,13 +494,6 @@ static void reportError(Ejs *ejs, EjsVar *vp)
 
 static EjsVar *createVar(Ejs *ejs, EjsType *type, int size)
 {
-    EjsVar      *vp;
-
-    if (size == 0 && (vp = ejsAllocPooledVar(ejs, type->id)) != NULL) {
-        memset(vp, 0, type->instanceSize);
-        vp->type = type;
-        return vp;
-    }
     return ejsAllocVar(ejs, type, size);
 }
 
@@ -739,6 +714,115 @@ EjsName *ejsName(EjsName *np, cchar *space, cchar *name)
 }
 
 
+/*
+ *  Intern a name string. Cloned interpreters consult the master's atoms first so that names loaded by the master
+ *  (and referenced by the shared core types) compare by pointer. The master may still intern names while clones run,
+ *  so the atoms are only accessed while holding the owning interpreter's lock.
+ */
+cchar *ejsInternString(Ejs *ejs, cchar *str)
+{
+    return intern(ejs, str, 1);
+}
+
+
+/*
+ *  Intern a string that will persist for the life of the interpreter. Used for module constant pool strings.
+ */
+cchar *ejsInternConstant(Ejs *ejs, cchar *str)
+{
+    return intern(ejs, str, 0);
+}
+
+
+static cchar *intern(Ejs *ejs, cchar *str, int dup)
+{
+    EjsAtoms    *atoms;
+    cchar       *atom;
+    int         index;
+
+    mprAssert(str);
+
+    if (ejs->master) {
+        ejsLockVm(ejs->master);
+        atom = lookupAtom(&ejs->master->atoms, str, &index);
+        ejsUnlockVm(ejs->master);
+        if (atom) {
+            return atom;
+        }
+    }
+    atoms = &ejs->atoms;
+    ejsLockVm(ejs);
+    if ((atom = lookupAtom(atoms, str, &index)) == 0) {
+        if ((atoms->count + 1) * 2 > atoms->size) {
+            if (growAtoms(ejs, atoms) < 0) {
+                ejsUnlockVm(ejs);
+                return str;
+            }
+            lookupAtom(atoms, str, &index);
+        }
+        if (dup && (str = mprStrdup(ejs, str)) == 0) {
+            ejsUnlockVm(ejs);
+            return 0;
+        }
+        atoms->strings[index] = atom = str;
+        atoms->count++;
+    }
+    ejsUnlockVm(ejs);
+    return atom;
+}
+
+
+/*
+ *  Find an interned string. If not found, set *index to the free hash entry for the string.
+ */
+static cchar *lookupAtom(EjsAtoms *atoms, cchar *str, int *index)
+{
+    cchar   *atom, *cp;
+    uint    hash;
+    int     i;
+
+    *index = -1;
+    if (atoms->size == 0) {
+        return 0;
+    }
+    for (hash = 0, cp = str; *cp; cp++) {
+        hash = (hash * 31) + (uchar) *cp;
+    }
+    for (i = hash & (atoms->size - 1); (atom = atoms->strings[i]) != 0; i = (i + 1) & (atoms->size - 1)) {
+        if (atom[0] == str[0] && strcmp(atom, str) == 0) {
+            return atom;
+        }
+    }
+    *index = i;
+    return 0;
+}
+
+
+static int growAtoms(Ejs *ejs, EjsAtoms *atoms)
+{
+    cchar   **old, *atom;
+    int     i, index, oldSize;
+
+    old = atoms->strings;
+    oldSize = atoms->size;
+    atoms->size = (oldSize) ? (oldSize * 2) : EJS_ATOM_HASH_SIZE;
+    atoms->strings = (cchar**) mprAllocZeroed(ejs, atoms->size * (int) sizeof(cchar*));
+    if (atoms->strings == 0) {
+        atoms->strings = old;
+        atoms->size = oldSize;
+        return EJS_ERR;
+    }
+    for (i = 0; i < oldSize; i++) {
+        if ((atom = old[i]) != 0) {
+            lookupAtom(atoms, atom, &index);
+            atoms->strings[index] = atom;
+        }
+    }
+    mprFree(old);
+    return 0;
+}
+
+
 void ejsZeroSlots(Ejs *ejs, EjsVar **slots, int count)
 {
     int     i;
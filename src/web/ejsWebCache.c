@@ -53,7 +53,9 @@ static EjsVar *readCache(Ejs *ejs, EjsWebCache *cp, int argc, EjsVar **argv)
         ejsUnlockVm(master);
         return ejs->nullValue;
     }
-    vp = ejsDeserialize(ejs, (EjsString*) vp);
+    if (ejsIsByteArray(vp)) {
+        vp = ejsDecodeClone(ejs, (cchar*) ((EjsByteArray*) vp)->value, ((EjsByteArray*) vp)->writePosition, 0);
+    }
     if (vp == ejs->undefinedValue) {
         vp = (EjsVar*) ejs->emptyStringValue;
     }
@@ -91,7 +93,10 @@ static EjsVar *writeCache(Ejs *ejs, EjsWebCache *cp, int argc, EjsVar **argv)
     key = ejsGetString(argv[1]);
     ejsLockVm(master);
 
-    value = (EjsVar*) ejsSerialize(master, argv[2], 0, 0, 0);
+    if ((value = (EjsVar*) ejsCloneToByteArray(ejs, master, argv[2])) == 0) {
+        ejsUnlockVm(master);
+        return 0;
+    }
     ejsSetPropertyByName(master, cp->cache, ejsName(&qname, domain, key), value);
     ejsUnlockVm(master);
     return 0;
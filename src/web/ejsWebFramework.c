@@ -18,6 +18,22 @@
  */
 static EjsWebControl *webControl;
 
+/*
+ *  Pool of idle interpreters for one application
+ */
+typedef struct EjsWebPool {
+    MprList         *idle;                  /* Idle interpreters */
+} EjsWebPool;
+
+/*
+ *  Pooled interpreter. Pooled interpreters keep their loaded modules and types between requests.
+ */
+typedef struct EjsWebInterp {
+    Ejs             *ejs;                   /* Interpreter */
+    EjsWebPool      *pool;                  /* Owning pool */
+    int             requests;               /* Count of requests served */
+} EjsWebInterp;
+
 /***************************** Forward Declarations ***************************/
 /*
  *  Support auto recompilation if cross compiler is enabled or building native
@@ -33,14 +49,21 @@ static int  compile(EjsWeb *web, cchar *shell, cchar *kind, cchar *name);
 static char *locateShell(EjsWeb *web);
 #endif
 
+static Ejs  *acquireInterp(EjsWeb *web, cchar *searchPath);
 static int caselessmatch(cchar *url, cchar *ext);
 static void createCookie(Ejs *ejs, EjsVar *cookies, cchar *name, cchar *value, cchar *domain, cchar *path);
+static int  destroyWeb(EjsWeb *web);
 static int  initInterp(Ejs *ejs, EjsWebControl *control);
+static void lockControl(EjsWebControl *control);
+static void releaseInterp(EjsWeb *web);
+static void resetRequestGlobals(Ejs *ejs);
+static void unlockControl(EjsWebControl *control);
 static int  loadApplication(EjsWeb *web);
 static int  loadController(EjsWeb *web);
 static int  loadComponent(EjsWeb *web, cchar *kind, cchar *name, cchar *sourceExtension);
 static int  build(EjsWeb *web, cchar *kind, cchar *name, cchar *module, cchar *sourceExtension, int force);
 static int  parseControllerAction(EjsWeb *web);
+static int  runRequest(EjsWeb *web);
 
 /************************************ Code ************************************/
 /*
@@ -169,7 +192,7 @@ EjsWeb *ejsCreateWebRequest(MprCtx ctx, EjsWebControl *control, void *handle, cc
     EjsWeb          *web;
     cchar           *appUrl;
 
-    web = (EjsWeb*) mprAllocObjZeroed(ctx, EjsWeb);
+    web = (EjsWeb*) mprAllocObjWithDestructorZeroed(ctx, EjsWeb, destroyWeb);
     if (web == 0) {
         return 0;
     }
@@ -190,7 +213,13 @@ EjsWeb *ejsCreateWebRequest(MprCtx ctx, EjsWebControl *control, void *handle, cc
 
     mprLog(ctx, 3, "ejs: CreateWebRequest: AppDir %s, AppUrl %s, URL %s", web->appDir, web->appUrl, web->url);
 
-    if (control->master) {
+    if (control->getPoolLimits) {
+        control->getPoolLimits(handle, &web->poolSize, &web->poolRecycle);
+    }
+    if (web->poolSize > 0) {
+        ejs = web->ejs = acquireInterp(web, searchPath);
+
+    } else if (control->master) {
         ejs = web->ejs = ejsCreate(ctx, control->master, searchPath, 0);
         ejs->master = control->master;
     } else {
@@ -209,6 +238,166 @@ EjsWeb *ejsCreateWebRequest(MprCtx ctx, EjsWebControl *control, void *handle, cc
 }
 
 
+static int destroyWeb(EjsWeb *web)
+{
+    if (web->interp) {
+        releaseInterp(web);
+    }
+    return 0;
+}
+
+
+/*
+ *  Get a warm interpreter for the request's application from the pool or create a new pooled interpreter. 
+ *  Applications are distinguished by their directory and module search path.
+ */
+static Ejs *acquireInterp(EjsWeb *web, cchar *searchPath)
+{
+    EjsWebControl   *control;
+    EjsWebInterp    *interp;
+    EjsWebPool      *pool;
+    MprCtx          ctx;
+    Ejs             *ejs;
+    char            *key;
+
+    control = web->control;
+    key = mprStrcat(web, -1, web->appDir, MPR_SEARCH_SEP, searchPath, NULL);
+
+    lockControl(control);
+    if (control->pools == 0) {
+        control->pools = mprCreateHash(control, 0);
+    }
+    if ((pool = (EjsWebPool*) mprLookupHash(control->pools, key)) == 0) {
+        if ((pool = mprAllocObjZeroed(control, EjsWebPool)) != 0) {
+            pool->idle = mprCreateList(pool);
+            mprAddHash(control->pools, key, pool);
+        }
+    }
+    interp = 0;
+    if (pool && (interp = mprGetLastItem(pool->idle)) != 0) {
+        mprRemoveLastItem(pool->idle);
+
+    } else if (pool && (interp = mprAllocObjZeroed(pool, EjsWebInterp)) != 0) {
+        interp->pool = pool;
+    }
+    unlockControl(control);
+    mprFree(key);
+
+    if (interp == 0) {
+        return 0;
+    }
+    if (interp->ejs == 0) {
+        /*
+         *  Ejs works best with a heap-based allocator for longer running apps.
+         */
+        ctx = mprAllocHeap(interp, "Ejs Interpreter", 1, 0, NULL);
+        if (control->master) {
+            ejs = ejsCreate(ctx, control->master, searchPath, 0);
+        } else {
+            ejs = ejsCreate(ctx, NULL, searchPath, 0);
+            if (ejs && initInterp(ejs, control) < 0) {
+                ejs = 0;
+            }
+        }
+        if (ejs == 0) {
+            mprFree(interp);
+            return 0;
+        }
+        if (control->master) {
+            ejs->master = control->master;
+        }
+        interp->ejs = ejs;
+    }
+    web->interp = interp;
+    return interp->ejs;
+}
+
+
+/*
+ *  Return an interpreter to its pool when the request completes. Per-request state is reset, but loaded modules and
+ *  types are preserved. Interpreters are discarded if the pool is full, the script exited or the interpreter has 
+ *  served its quota of requests.
+ */
+static void releaseInterp(EjsWeb *web)
+{
+    EjsWebControl   *control;
+    EjsWebInterp    *interp;
+    EjsState        *state;
+    Ejs             *ejs;
+    bool            reuse;
+
+    control = web->control;
+    interp = web->interp;
+    web->interp = 0;
+    ejs = interp->ejs;
+
+    interp->requests++;
+    reuse = !(ejs->flags & EJS_FLAG_EXIT) && !ejs->gc.degraded && 
+        (web->poolRecycle <= 0 || interp->requests < web->poolRecycle);
+    if (reuse) {
+        ejs->handle = 0;
+        ejsClearException(ejs);
+        state = ejs->state = ejs->masterState;
+        state->fp = 0;
+        state->bp = 0;
+        state->stack = &state->stackBase[-1];
+        state->frames = state->framesBase;
+        resetRequestGlobals(ejs);
+        ejsSetGeneration(ejs, EJS_GEN_NEW);
+        /*
+         *  The controller and request objects are allocated in the eternal generation, so collect all generations
+         */
+        ejsCollectGarbage(ejs, EJS_GEN_ETERNAL);
+    }
+    lockControl(control);
+    if (reuse && mprGetListCount(interp->pool->idle) < web->poolSize) {
+        mprAddItem(interp->pool->idle, interp);
+        interp = 0;
+    }
+    unlockControl(control);
+    if (interp) {
+        mprFree(interp);
+    }
+}
+
+
+/*
+ *  Clear global references to the last request so a pooled interpreter can't expose one request's state to the 
+ *  next. The current view references the controller and through it the request, response, params and session.
+ */
+static void resetRequestGlobals(Ejs *ejs)
+{
+    EjsName     qname;
+    int         slotNum;
+
+    slotNum = ejsLookupProperty(ejs, ejs->global, ejsName(&qname, "ejs.web", "view"));
+    if (slotNum >= 0) {
+        ejsSetProperty(ejs, ejs->global, slotNum, ejs->nullValue);
+    }
+    ejs->result = ejs->undefinedValue;
+}
+
+
+static void lockControl(EjsWebControl *control)
+{
+#if BLD_FEATURE_MULTITHREAD
+    if (control->lock) {
+        (control->lock)(control->lockData);
+    }
+#endif
+}
+
+
+static void unlockControl(EjsWebControl *control)
+{
+#if BLD_FEATURE_MULTITHREAD
+    if (control->unlock) {
+        (control->unlock)(control->lockData);
+    }
+#endif
+}
+
+
 /*
  *  Parse the request URI and create the controller and action names. URI is in the form: "controller/action"
  */
@@ -375,10 +564,7 @@ static int getDoAction(EjsWeb *web)
 }
 
 
-/*
- *  Run a web request
- */
-int ejsRunWebRequest(EjsWeb *web)
+static int runRequest(EjsWeb *web)
 {
     Ejs             *ejs;
     EjsVar          *result, *argv[1];
@@ -409,6 +595,38 @@ int ejsRunWebRequest(EjsWeb *web)
 }
 
 
+/*
+ *  Run a web request. If profiling is enabled, the request is sampled and the profile appended to the profile file.
+ */
+int ejsRunWebRequest(EjsWeb *web)
+{
+    EjsWebControl   *control;
+    Ejs             *ejs;
+    int             rc;
+
+    ejs = web->ejs;
+    control = web->control;
+
+    if (control->profilePath == 0) {
+        return runRequest(web);
+    }
+    ejsResetProfiler(ejs);
+    if (ejsStartProfiler(ejs, control->profileInterval) < 0) {
+        return runRequest(web);
+    }
+    rc = runRequest(web);
+    ejsStopProfiler(ejs);
+
+    lockControl(control);
+    if (ejsWriteProfile(ejs, control->profilePath, 1) < 0) {
+        mprError(web, "Can't write profile to %s", control->profilePath);
+    }
+    unlockControl(control);
+    ejsResetProfiler(ejs);
+    return rc;
+}
+
+
 int ejsLoadView(Ejs *ejs)
 {
     EjsWeb      *web;
@@ -1,7 +1,7 @@
 /**
  *  ejsWebSession.c - Native code for the Session class.
  *
- *  The Session class serializes objects that are stored to the session object.
+ *  The Session class encodes values that are stored to the session object using the structured clone format.
  *
  *  Copyright (c) All Rights Reserved. See details at the end of the file.
  */
@@ -33,8 +33,8 @@ static EjsVar *getSessionProperty(Ejs *ejs, EjsWebSession *sp, int slotNum)
     ejsLockVm(master);
 
     vp = ejs->objectHelpers->getProperty(ejs, (EjsVar*) sp, slotNum);
-    if (vp) {
-        vp = ejsDeserialize(ejs, (EjsString*) vp);
+    if (vp && ejsIsByteArray(vp)) {
+        vp = ejsDecodeClone(ejs, (cchar*) ((EjsByteArray*) vp)->value, ((EjsByteArray*) vp)->writePosition, 0);
     }
     if (vp == ejs->undefinedValue) {
         vp = (EjsVar*) ejs->emptyStringValue;
@@ -69,8 +69,8 @@ static EjsVar *getSessionPropertyByName(Ejs *ejs, EjsWebSession *sp, EjsName *qn
         vp = (EjsVar*) ejs->emptyStringValue;
     } else {
         vp = ejs->objectHelpers->getProperty(ejs, (EjsVar*) sp, slotNum);
-        if (vp) {
-            vp = ejsDeserialize(ejs, (EjsString*) vp);
+        if (vp && ejsIsByteArray(vp)) {
+            vp = ejsDecodeClone(ejs, (cchar*) ((EjsByteArray*) vp)->value, ((EjsByteArray*) vp)->writePosition, 0);
         }
     }
     sessionActivity(ejs, sp);
@@ -91,12 +91,15 @@ static int setSessionProperty(Ejs *ejs, EjsWebSession *sp, int slotNum, EjsVar *
     }
 
     /*
-     *  Allocate the serialized object using the master interpreter
+     *  Encode the value in a byte array allocated using the master interpreter
      */
     master = ejs->master ? ejs->master : ejs;
     ejsLockVm(master);
 
-    value = (EjsVar*) ejsSerialize(master, value, 0, 0, 0);
+    if ((value = (EjsVar*) ejsCloneToByteArray(ejs, master, value)) == 0) {
+        ejsUnlockVm(master);
+        return EJS_ERR;
+    }
     slotNum = master->objectHelpers->setProperty(master, (EjsVar*) sp, slotNum, value);
     sessionActivity(ejs, sp);
     ejsUnlockVm(master);
@@ -150,7 +153,10 @@ static void sessionTimer(EjsWebControl *control, MprEvent *event)
             }
         }
         if (deleted) {
-            ejsCollectGarbage(master, EJS_GEN_NEW);
+            /*
+             *  Sessions are long lived and will have been promoted, so a major collection is required to free them
+             */
+            ejsCollectGarbage(master, EJS_GEN_OLD);
         }
         if (count == 0) {
             control->sessionTimer = 0;
@@ -13,6 +13,13 @@
  #include    "appweb.h"
 
 /*********************************** Locals ***********************************/
+/*
+ *  Interpreter pool limits configured by EjsInterpreterPool. Stored as the handler data of the location.
+ */
+typedef struct EjsPoolLimits {
+    int         size;                       /* Max idle interpreters per application */
+    int         recycle;                    /* Requests before a pooled interpreter is recycled. Zero for no limit */
+} EjsPoolLimits;
 
 #if BLD_FEATURE_MULTITHREAD
 static void ejsWebLock(void *lockData);
@@ -22,6 +29,7 @@ static void ejsWebUnlock(void *lockData);
 /***************************** Forward Declarations *****************************/
 
 static void error(void *handle, int code, cchar *fmt, ...);
+static void getPoolLimits(void *handle, int *size, int *recycle);
 static void redirect(void *handle, int code, cchar *url);
 static void setCookie(void *handle, cchar *name, cchar *value, cchar *path, cchar *domain, int lifetime, bool secure);
 static void setHeader(void *handle, bool allowMultiple, cchar *key, cchar *fmt, ...);
@@ -86,7 +94,7 @@ static void openEjs(MaQueue *q)
     MprCtx          ctx;
     MaAlias         *alias;
     char            *url, *baseDir, *cp, *baseUrl, *searchPath;
-    int             flags;
+    int             flags, poolSize, poolRecycle;
 
     /*
      *  Send non-ejs content under web to another handler, typically the file handler.
@@ -164,10 +172,18 @@ static void openEjs(MaQueue *q)
     } else {
         searchPath = mprAsprintf(req, -1, "%s" MPR_SEARCH_SEP "%s", searchPath, control->searchPath);
     }
-    /*
-     *  Ejs works best with a heap-based allocator for longer running apps.
-     */
-    ctx = mprAllocHeap(req, "Ejs Interpreter", 1, 0, NULL);
+    getPoolLimits(conn, &poolSize, &poolRecycle);
+    if (poolSize > 0) {
+        /*
+         *  Pooled interpreters have their own heaps and outlive the request
+         */
+        ctx = req;
+    } else {
+        /*
+         *  Ejs works best with a heap-based allocator for longer running apps.
+         */
+        ctx = mprAllocHeap(req, "Ejs Interpreter", 1, 0, NULL);
+    }
     web = ejsCreateWebRequest(ctx, control, conn, baseUrl, url, baseDir, searchPath, flags);
     if (web == 0) {
         maFailRequest(conn, MPR_HTTP_CODE_INTERNAL_SERVER_ERROR, "Can't create Ejs web object for %s", url);
@@ -571,6 +587,27 @@ static cchar *getHeader(void *handle, cchar *key)
 }
 
 
+/*
+ *  Get the interpreter pool limits for the request location. Nested locations inherit the limits of their parents.
+ */
+static void getPoolLimits(void *handle, int *size, int *recycle)
+{
+    MaConn          *conn;
+    MaLocation      *loc;
+    EjsPoolLimits   *limits;
+
+    conn = handle;
+    *size = *recycle = 0;
+    for (loc = conn->request->location; loc; loc = loc->parent) {
+        if ((limits = loc->handlerData) != 0) {
+            *size = limits->size;
+            *recycle = limits->recycle;
+            break;
+        }
+    }
+}
+
+
 static EjsVar *getVar(void *handle, int collection, int field)
 {
     switch (collection) {
@@ -692,7 +729,9 @@ static int parseEjs(MaHttp *http, cchar *key, char *value, MaConfigState *state)
 {
     MaLocation      *location;
     MaServer        *server;
-    char            *prefix, *path;
+    EjsWebControl   *control;
+    EjsPoolLimits   *limits;
+    char            *prefix, *path, *size, *recycle, *tok;
     int             flags;
     
     server = state->server;
@@ -795,6 +834,38 @@ static int parseEjs(MaHttp *http, cchar *key, char *value, MaConfigState *state)
         }
         return 1;
 
+    } else if (mprStrcmpAnyCase(key, "EjsInterpreterPool") == 0) {
+        /*
+         *  EjsInterpreterPool maxIdle [maxRequests]. Applies to the enclosing location or virtual host.
+         */
+        if ((size = mprStrTok(value, " \t", &tok)) == 0) {
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        if ((limits = mprAllocObjZeroed(location, EjsPoolLimits)) == 0) {
+            return MPR_ERR_NO_MEMORY;
+        }
+        limits->size = atoi(size);
+        if ((recycle = mprStrTok(0, " \t", &tok)) != 0) {
+            limits->recycle = atoi(recycle);
+        }
+        location->handlerData = limits;
+        return 1;
+
+    } else if (mprStrcmpAnyCase(key, "EjsProfile") == 0) {
+        /*
+         *  EjsProfile path [interval]
+         */
+        control = (EjsWebControl*) http->ejsHandler->stageData;
+        if ((path = mprStrTok(value, " \t", &tok)) == 0) {
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        path = mprStrTrim(path, "\"");
+        control->profilePath = mprStrdup(control, path);
+        if ((size = mprStrTok(0, " \t", &tok)) != 0) {
+            control->profileInterval = atoi(size);
+        }
+        return 1;
+
     } else if (mprStrcmpAnyCase(key, "EjsSession") == 0) {
         if (mprStrcmpAnyCase(value, "on") == 0) {
             location->flags |= MA_LOC_AUTO_SESSION;
@@ -844,6 +915,7 @@ MprModule *maEjsHandlerInit(MaHttp *http, cchar *path)
     control->discardOutput = discardOutput;
     control->error = error;
     control->getHeader = getHeader;
+    control->getPoolLimits = getPoolLimits;
     control->getVar = getVar;
     control->redirect = redirect;
     control->setCookie = setCookie;
@@ -0,0 +1,36 @@
+/*
+ *	Array sort benchmarks for sorted, reversed and random input
+ */
+
+function report(msg, count, when) {
+    let t = when.elapsed / 10
+    print("%25s %5d.%02d (%,10d)" % [ msg, t / 100, t % 100, count])
+}
+
+function numeric(a, b) {
+	return a - b
+}
+
+var count: Number = 100000
+var sorted: Array = []
+var reversed: Array = []
+var random: Array = []
+var i: Number
+
+for (i = 0; i < count; i++) {
+	sorted.push(i)
+	reversed.push(count - i)
+	random.push(Math.floor(Math.random() * count))
+}
+
+var inputs = { "Sorted": sorted, "Reversed": reversed, "Random": random }
+for (name in inputs) {
+	let data = inputs[name]
+	let mark: Date = new Date
+	data.slice(0).sort()
+	report(name + " Sort", count, mark)
+
+	mark = new Date
+	data.slice(0).sort(numeric)
+	report(name + " Compare Sort", count, mark)
+}
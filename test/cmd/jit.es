@@ -0,0 +1,66 @@
+/*
+ *  jit.es - Script run by jit.tst. Functions become hot and are translated, then see operands of other types.
+ */
+
+function check(cond, message) {
+    if (!cond) {
+        throw new Error("Failed: " + message)
+    }
+}
+
+function arith(a, b) {
+    return a + b * 2 - 1
+}
+
+function add(a, b) {
+    return a + b
+}
+
+function compare(a, b) {
+    var result = 0
+    if (a < b) result += 1
+    if (a <= b) result += 2
+    if (a > b) result += 4
+    if (a >= b) result += 8
+    if (a == b) result += 16
+    if (a != b) result += 32
+    return result
+}
+
+function count(n) {
+    var total = 0
+    for (var i = 0; i < n; i++) {
+        total++
+    }
+    return total
+}
+
+//  Warm up with numbers so the functions are translated
+for (i = 0; i < 3000; i++) {
+    check(arith(i, 1) == i + 1, "arith numbers")
+    check(add(i, i) == i * 2, "add numbers")
+    check(compare(i, 1500) == ((i < 1500) ? 35 : ((i == 1500) ? 26 : 44)), "compare numbers")
+}
+check(count(5000) == 5000, "count loop")
+
+//  Translated code must still handle other operand types
+check(add("a", 1) == "a1", "add string")
+check(add(1, "a") == "1a", "add number string")
+check(add(true, 1) == 2, "add boolean")
+var n = arith("a", 1)
+check(n.isNaN, "arith string")
+check(arith(1.5, 0.25) == 1, "arith fraction")
+n = arith(undefined, 1)
+check(n.isNaN, "arith undefined")
+check(compare("a", "b") == 35, "compare strings")
+check(compare("b", "b") == 26, "compare equal strings")
+check(compare(Number.NaN, 1) == 32, "compare NaN")
+check(compare(null, 0) != 0, "compare null")
+check(count(0) == 0, "count zero")
+
+var s = ""
+for (i = 0; i < 2000; i++) {
+    s = s + "x"
+}
+check(s.length == 2000, "string loop")
+print("pass")
@@ -0,0 +1,6 @@
+/*
+ *  jit.tst - Test translation of hot functions (ejs --jit)
+ */
+
+let result = sh(locate("ejs") + " --jit cmd/jit.es")
+assert(result.trim() == "pass")
@@ -0,0 +1,105 @@
+/*
+ *  Test unbound property access through the same instruction with changing receivers (inline caches)
+ */
+class Shape {
+    var origin = 1
+
+    public function getOrigin() {
+        return origin
+    }
+}
+
+class Circle extends Shape {
+    var radius = 7
+
+    public override function getOrigin() {
+        return origin + 100
+    }
+}
+
+dynamic class Box {
+    public var width = 3
+}
+
+function getWidth(o) {
+    return o.width
+}
+
+function callOrigin(o) {
+    return o.getOrigin()
+}
+
+function setWidth(o, v) {
+    o.width = v
+}
+
+
+//  Polymorphic receivers through one call site
+var shapes = [new Shape, new Circle, new Shape, new Circle]
+for (i = 0; i < 3; i++) {
+    assert(callOrigin(shapes[0]) == 1)
+    assert(callOrigin(shapes[1]) == 101)
+    assert(callOrigin(shapes[2]) == 1)
+    assert(callOrigin(shapes[3]) == 101)
+}
+
+//  Same type, different shapes after dynamic properties are added
+var b1 = new Box
+var b2 = new Box
+b2.depth = 4
+for (i = 0; i < 3; i++) {
+    assert(getWidth(b1) == 3)
+    assert(getWidth(b2) == 3)
+}
+
+//  Plain objects with differing layouts
+var objects = [{width: 1}, {height: 2, width: 5}, {width: 9, depth: 1}, {a: 1, b: 2, width: 11}, {width: 13}]
+for (i = 0; i < 3; i++) {
+    assert(getWidth(objects[0]) == 1)
+    assert(getWidth(objects[1]) == 5)
+    assert(getWidth(objects[2]) == 9)
+    assert(getWidth(objects[3]) == 11)
+    assert(getWidth(objects[4]) == 13)
+}
+
+//  Missing then added
+var o = {}
+assert(getWidth(o) == undefined)
+o.width = 21
+assert(getWidth(o) == 21)
+
+//  Deleted properties must not be found
+var d = {width: 2}
+assert(getWidth(d) == 2)
+delete d.width
+assert(getWidth(d) == undefined)
+
+//  Stores through a cached site
+var b3 = new Box
+setWidth(b3, 30)
+setWidth(b1, 31)
+assert(b3.width == 30)
+assert(b1.width == 31)
+assert(getWidth(b3) == 30)
+
+//  Primitive receivers
+function len(s) {
+    return s.length
+}
+assert(len("abc") == 3)
+assert(len([1, 2]) == 2)
+assert(len("abcdef") == 6)
+
+//  Types with their own property helpers
+function messageOf(e) {
+    return e.message
+}
+try {
+    throw new Error("caught")
+} catch (e) {
+    assert(e.message == "caught")
+    assert(e.stack is String && e.stack != "")
+    assert(messageOf(e) == "caught")
+}
+assert(messageOf(new Error("x")) == "x")
+assert(messageOf(new Error("y")) == "y")
@@ -0,0 +1,110 @@
+/*
+ *  Constant expressions folded by the compiler must match the same expressions evaluated at run time
+ */
+
+var two = 2, three = 3, str = "a", yes = true
+
+assert(2 * 3 + 1 == two * three + 1)
+assert(7 / 2 == 3.5)
+assert(7 % 3 == 1)
+assert(1 << 4 == 16)
+assert(-16 >> 2 == -4)
+assert((5 & 3) == 1 && (5 | 3) == 7 && (5 ^ 3) == 6)
+assert(~5 == -6)
+assert(-(3) == -three)
+assert("a" + "b" + 1 == str + "b" + 1)
+assert("x" + 2 * 3 == "x6")
+assert(1 + 2 + "z" == "3z")
+assert(!true == !yes)
+assert((2 < 3) == (two < three))
+assert(("a" == "a") === true)
+assert((1 / 0) == Number.POSITIVE_INFINITY)
+var nan = 0 / 0
+assert(nan != nan)
+
+//  Constant conditions
+var count = 0
+if (true) {
+    count++
+} else {
+    assert(0)
+}
+if (false) {
+    assert(0)
+}
+if (1 > 2) {
+    assert(0)
+} else {
+    count++
+}
+assert(count == 2)
+assert((true ? "then" : "else") == "then")
+assert((0 ? "then" : "else") == "else")
+
+//  Functions in a branch that never runs are still defined
+if (false) {
+    function never() {
+        return "never"
+    }
+}
+
+//  Loop with a constant condition
+var i = 0
+while (true) {
+    if (++i >= 5) {
+        break
+    }
+}
+assert(i == 5)
+
+//  Code after return and throw is never run. Functions declared after a return are still defined.
+function early(x) {
+    if (x) {
+        return "then"
+    } else {
+        return "else"
+    }
+    assert(0)
+}
+assert(early(true) == "then")
+assert(early(false) == "else")
+
+function hoisted() {
+    return inner()
+    function inner() {
+        return "inner"
+    }
+}
+assert(hoisted() == "inner")
+
+function thrower() {
+    throw "thrown"
+    assert(0)
+}
+var caught
+try {
+    thrower()
+} catch (e) {
+    caught = e
+}
+assert(caught == "thrown")
+
+//  Jumps to jumps
+function nested(a, b) {
+    var result = 0
+    for (var j = 0; j < 3; j++) {
+        if (a) {
+            if (b) {
+                result += 1
+            } else {
+                result += 2
+            }
+        } else {
+            continue
+        }
+    }
+    return result
+}
+assert(nested(true, true) == 3)
+assert(nested(true, false) == 6)
+assert(nested(false, false) == 0)
@@ -0,0 +1,61 @@
+/*
+ *  Arithmetic and comparisons on operands declared as numbers and strings
+ */
+
+function typed(a: Number, b: Number): Array {
+    var i: Number = a
+    i++
+    --i
+    return [a + b, a - b, a * b, a / b, a < b, a <= b, a == b, a != b, a > b, a >= b, i]
+}
+
+function untyped(a, b): Array {
+    var i = a
+    i++
+    --i
+    return [a + b, a - b, a * b, a / b, a < b, a <= b, a == b, a != b, a > b, a >= b, i]
+}
+
+function same(x, y) {
+    if (x.length != y.length) {
+        return false
+    }
+    for (i in x) {
+        if (!(x[i] === y[i] || (x[i] != x[i] && y[i] != y[i]))) {
+            return false
+        }
+    }
+    return true
+}
+
+for each (pair in [[7, 2], [-3, 3], [1.5, 0.25], [5, 0], [0, 0]]) {
+    assert(same(typed(pair[0], pair[1]), untyped(pair[0], pair[1])))
+}
+assert(typed(1, 0)[3] == Number.POSITIVE_INFINITY)
+
+//  Typed locals in a loop
+function sum(n: Number): Number {
+    var total: Number = 0
+    for (var i: Number = 0; i < n; i++) {
+        total = total + i / 2
+    }
+    return total
+}
+assert(sum(10) == 22.5)
+
+//  Typed strings
+function join(a: String, b: String): String {
+    return a + b
+}
+assert(join("ab", "cd") == "abcd")
+
+//  Typed numbers that hold null
+function nulls(): Array {
+    var n: Number = null
+    var m: Number = 2
+    return [n + m, n < m]
+}
+var r = nulls()
+var n = null
+assert(r[0] === n + 2 || (r[0] != r[0] && (n + 2) != (n + 2)))
+assert(r[1] == (n < 2))
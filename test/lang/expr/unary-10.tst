@@ -0,0 +1,57 @@
+/*
+ *	Increment and update of local variables holding values other than numbers
+ */
+
+function incLocals() {
+    var n = 1, s = "5", b = true, u
+    n++
+    ++n
+    n--
+    s++
+    b++
+    u++
+    return [n, s, b, u]
+}
+for (i = 0; i < 3; i++) {
+    var r = incLocals()
+    assert(r[0] == 2)
+    assert(r[1] == "51")
+    assert(r[2] == 2)
+    assert(r[3] == 1)
+}
+
+function updateLocals() {
+    var n = 10, s = "a", d = 1.5
+    n = n + 1
+    n = n - 300
+    n += 2
+    n -= 1
+    s = s + 1
+    s = s - 1
+    d = d + 1
+    return [n, s, d]
+}
+for (i = 0; i < 3; i++) {
+    r = updateLocals()
+    assert(r[0] == -288)
+    assert(r[1] != r[1])
+    assert(r[2] == 2.5)
+}
+
+//  Compare and branch with numbers, strings and null
+function compare(a, b) {
+    var count = 0
+    if (a < b) count++
+    if (a <= b) count++
+    if (a == b) count++
+    while (a > b) {
+        count++
+        break
+    }
+    return count
+}
+assert(compare(1, 2) == 2)
+assert(compare(2, 1) == 1)
+assert(compare("a", "b") == 2)
+assert(compare("b", "b") == 2)
+assert(compare(null, 0) == 1)
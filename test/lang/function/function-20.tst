@@ -0,0 +1,104 @@
+/*
+ *  Test function frames that outlive their call (closures) and frames released by returns and exceptions
+ */
+
+//  Closure captures the frame after locals are set
+function counter(start) {
+    var count = start
+    return function() {
+        count++
+        return count
+    }
+}
+var c1 = counter(10)
+var c2 = counter(20)
+assert(c1() == 11)
+assert(c1() == 12)
+assert(c2() == 21)
+
+//  Locals updated after the closure is defined are seen by the closure
+function later() {
+    var value = 1
+    var get = function() {
+        return value
+    }
+    value = 2
+    return get
+}
+var get = later()
+assert(get() == 2)
+
+//  Closures defined inside a nested block
+function blocks(n) {
+    var result = []
+    for (var i = 0; i < n; i++) {
+        let j = i * 2
+        result.push(function() {
+            return j
+        })
+    }
+    return result
+}
+var fns = blocks(3)
+var fn0 = fns[0]
+var fn2 = fns[2]
+assert(fn2() == 4)
+
+//  Frames are released when an exception unwinds through them
+function thrower(depth) {
+    var local = depth
+    if (depth == 0) {
+        throw new Error("bottom")
+    }
+    return thrower(depth - 1) + local
+}
+for (i = 0; i < 100; i++) {
+    caught = false
+    try {
+        thrower(20)
+    } catch (e) {
+        caught = true
+    }
+    assert(caught)
+}
+
+//  Closure created in a catch block
+function inCatch() {
+    var tag = "catch"
+    var fn
+    try {
+        throw "x"
+    } catch (e) {
+        fn = function() {
+            return tag + e
+        }
+    }
+    return fn
+}
+var caughtFn = inCatch()
+assert(caughtFn() == "catchx")
+
+//  Deep recursion. Frames beyond the end of the frame stack are allocated from the heap
+function depth(n) {
+    var a = n
+    if (n == 0) {
+        return 0
+    }
+    return depth(n - 1) + 1
+}
+assert(depth(200) == 200)
+
+//  Captured frames survive garbage collection while other frames are reused
+function churn(n) {
+    var o = {value: n}
+    return o.value
+}
+var keep = counter(100)
+for (i = 0; i < 2000; i++) {
+    churn(i)
+}
+GC.run()
+assert(keep() == 101)
+GC.run(true)
+assert(keep() == 102)
+assert(c1() == 13)
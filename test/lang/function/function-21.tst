@@ -0,0 +1,78 @@
+/*
+ *  Calls to small functions that the compiler may inline must behave as normal calls
+ */
+
+final function add(a, b) {
+    return a + b
+}
+final function square(x: Number): Number {
+    return x * x
+}
+final function pick(flag, a, b) {
+    return flag ? a : b
+}
+var x = 3, y = 4
+var n: Number = 5
+var str = "5"
+
+assert(add(x, y) == 7)
+assert(add(1, "a") == "1a")
+assert(add(str, x) == "53")
+assert(square(n) == 25)
+assert(square(str) == 25)
+assert(square(x) + square(y) == 25)
+assert(pick(true, x, y) == 3)
+assert(pick(false, x, y) == 4)
+
+//  Arguments with side effects are evaluated once
+var count = 0
+function next() {
+    return ++count
+}
+assert(add(next(), next()) == 3)
+assert(count == 2)
+
+//  Functions that are assigned to are not inlined
+function bump(v) {
+    return v + 1
+}
+assert(bump(x) == 4)
+bump = function(v) {
+    return v + 100
+}
+assert(bump(x) == 103)
+
+//  Global functions rebound at run time
+function sq(v) {
+    return v * v
+}
+function useSq() {
+    return sq(3)
+}
+assert(useSq() == 9)
+global["sq"] = function(v) {
+    return 0
+}
+assert(useSq() == 0)
+eval('sq = function(v) {\n    return 1\n}')
+assert(useSq() == 1)
+
+//  Final and static methods
+class Shape {
+    var w: Number = 3
+
+    final function area(a: Number, b: Number): Number {
+        return a * b
+    }
+    static function twice(n) {
+        return n * 2
+    }
+    function size(): Number {
+        var side: Number = w
+        return this.area(side, side) + area(side, 2) + twice(side)
+    }
+}
+class Square extends Shape {
+}
+assert(new Shape().size() == 21)
+assert(new Square().size() == 21)
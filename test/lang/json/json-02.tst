@@ -0,0 +1,27 @@
+/*
+ *  Compact and pretty serialization of nested objects
+ */
+
+var o = {name: "a \"b\"", list: [1, "two", true, null, {x: 1}], nested: {a: {b: {}}}}
+assert(serialize(o) == '{"name":"a \\"b\\"","list":[1,"two",true,null,{"x":1}],"nested":{"a":{"b":{}}}}')
+assert(JSON.stringify(o) == serialize(o))
+
+var pretty = serialize({a: 1, b: [2]}, 0, false, false, true)
+assert(pretty == '{\n  "a": 1,\n  "b": [\n    2\n  ]\n}')
+
+//  Round trip
+var copy = deserialize(serialize(o))
+assert(copy.name == o.name)
+assert(copy.list[1] == "two")
+assert(copy.list[4].x == 1)
+
+//  Depth limit
+assert(serialize(o, 2) == '{"name":"a \\"b\\"","list":[1,"two",true,null,{}],"nested":{"a":{}}}')
+
+//  Cycles
+var c = {v: 1}
+c.self = c
+assert(serialize(c) == '{"v":1,"self":this}')
+
+//  Types with their own toJSON
+assert(serialize({d: new Date(0)}).startsWith('{"d":"1970-01-01T00:00:00'))
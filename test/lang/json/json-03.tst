@@ -0,0 +1,78 @@
+/*
+ *  Deserialization and incremental parsing
+ */
+
+var o = deserialize('{"a": 1, b: "x\\ty\\u0041", "c": [1, 2, {d: true}], e: null, "public"::"f": -2.5}')
+assert(o.a == 1)
+assert(o.b == "x\tyA")
+assert(o.c.length == 3 && o.c[2].d === true)
+assert(o.e === null)
+assert(o.f == -2.5)
+assert(deserialize('"str"') is String)
+assert(deserialize("[1, 'two', 3]")[1] == "two")
+
+//  Objects with more properties than share a shape
+var big = {}
+for (i = 0; i < 100; i++) {
+    big["key" + i] = i
+}
+var copy = deserialize(serialize(big))
+assert(copy.key0 == 0 && copy.key99 == 99)
+
+//  Many distinct keys. Objects past the shape limits own their names
+var kept = []
+for (i = 0; i < 200; i++) {
+    kept.push(deserialize('{"unique' + i + '": ' + i + ', "public"::"ns' + i + '": 1}'))
+}
+GC.run()
+assert(kept[0].unique0 == 0 && kept[199].unique199 == 199)
+assert(kept[199].ns199 == 1)
+
+//  Trailing garbage
+var caught
+try {
+    deserialize('{a: 1} x')
+} catch (e) {
+    caught = e
+}
+assert(caught is SyntaxError)
+
+//  Incremental parsing of members split across writes
+var got = []
+function collect(value, key) {
+    got.push(key + "=" + serialize(value))
+}
+var parser = new JSONParser(collect)
+for each (chunk in ['{"a": [1, ', '2], "b"', ': {"c": "x,}', '"}, "d": 4', '2}']) {
+    parser.write(chunk)
+}
+parser.end()
+assert(got.join(" ") == 'a=[1,2] b={"c":"x,}"} d=42')
+
+//  Deeper values
+got = []
+parser = new JSONParser(collect, 2)
+parser.write('{"list": [1, "a", {"x": 1}], "other": {"y": 2}}')
+parser.end()
+assert(got.join(" ") == '0=1 1="a" 2={"x":1} y=2')
+
+//  Whole documents from a ByteArray
+got = []
+parser = new JSONParser(collect, 0)
+var ba = new ByteArray(100)
+ba.write('{"q": 1} [2] 33')
+parser.write(ba)
+assert(ba.available == 0)
+parser.end()
+assert(got.join(" ") == 'null={"q":1} null=[2] null=33')
+
+//  Incomplete input
+parser = new JSONParser(collect)
+parser.write('{"a": [1')
+caught = null
+try {
+    parser.end()
+} catch (e) {
+    caught = e
+}
+assert(caught is SyntaxError)
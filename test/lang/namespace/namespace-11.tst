@@ -0,0 +1,44 @@
+/*
+ *  Unqualified lookup of names defined in one or more namespaces
+ */
+
+namespace green
+namespace orange
+
+green var only = "green"
+green var both = "green"
+orange var both = "orange"
+
+//  Not visible until the namespace is opened
+var caught
+try {
+    only
+} catch (e) {
+    caught = e
+}
+assert(caught is ReferenceError)
+
+function readOnly() {
+    use namespace green
+    return only
+}
+assert(readOnly() == "green")
+
+//  The most recently opened namespace wins
+function readBoth() {
+    use namespace green
+    use namespace orange
+    return both
+}
+assert(readBoth() == "orange")
+
+//  Protected properties are only visible to sub classes
+class Base {
+    protected var secret = 7
+}
+class Derived extends Base {
+    function reveal() {
+        return secret
+    }
+}
+assert(new Derived().reveal() == 7)
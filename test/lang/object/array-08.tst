@@ -0,0 +1,56 @@
+/*
+    Test array sorting
+ */
+
+//  Default lexical sort
+assert([3, 1, 2].sort() == "1,2,3")
+assert([10, 9, 1].sort() == "1,10,9")
+assert(["b", "c", "a"].sort(null, -1) == "c,b,a")
+assert([].sort().length == 0)
+assert([7].sort() == "7")
+
+//  Comparator
+function numeric(a, b) {
+    return a - b
+}
+assert([10, 9, 1, 100].sort(numeric) == "1,9,10,100")
+assert([10, 9, 1, 100].sort(numeric, -1) == "100,10,9,1")
+
+//  Sorted, reversed and random input
+var sorted = []
+for (i = 0; i < 1000; i++) {
+    sorted.push(i)
+}
+var reversed = sorted.slice(0).reverse()
+var mixed = []
+for (i = 0; i < 1000; i++) {
+    mixed.push((i * 7919) % 1000)
+}
+assert(sorted.slice(0).sort(numeric) == sorted.toString())
+assert(reversed.sort(numeric) == sorted.toString())
+assert(mixed.sort(numeric) == sorted.toString())
+
+//  Stability
+var items = []
+for (i = 0; i < 500; i++) {
+    items.push({key: (i * 31) % 10, order: i})
+}
+items.sort(function (a, b) {
+    return a.key - b.key
+})
+for (i = 1; i < items.length; i++) {
+    assert(items[i - 1].key < items[i].key || (items[i - 1].key == items[i].key && items[i - 1].order < items[i].order))
+}
+
+//  Exceptions in the comparator leave the array unchanged
+var a = [3, 1, 2]
+var caught
+try {
+    a.sort(function (x, y) {
+        throw new Error("stop")
+    })
+} catch (e) {
+    caught = e
+}
+assert(caught is Error)
+assert(a == "3,1,2")
@@ -0,0 +1,79 @@
+/*
+ *  Structured clone encoding with writeObject and readObject
+ */
+
+var shared = {name: "shared"}
+var o = {num: 7, neg: -3, real: 1.5, big: 12345678901, str: "hello", yes: true, no: false, nothing: null,
+    when: new Date(1000), list: [1, "two", shared], first: shared, second: shared, bytes: new ByteArray(8)}
+o.self = o
+o.bytes.writeInteger(42)
+
+var ba = new ByteArray(16)
+ba.writeObject(o)
+ba.writeObject("after")
+var c = ba.readObject()
+assert(c.num == 7 && c.neg == -3 && c.real == 1.5 && c.big == 12345678901)
+assert(c.str == "hello" && c.yes === true && c.no === false && c.nothing === null)
+assert(c.when is Date && c.when.time == 1000)
+assert(c.list.length == 3 && c.list[1] == "two")
+
+//  Shared objects and cycles are preserved
+assert(c.first === c.second)
+assert(c.list[2] === c.first)
+assert(c.self === c)
+
+//  Byte arrays are copied with their positions
+assert(c.bytes is ByteArray && c.bytes !== o.bytes)
+assert(c.bytes.readInteger() == 42)
+
+//  Sequential objects
+assert(ba.readObject() == "after")
+assert(ba.readObject() == null)
+
+//  Objects with many properties
+var big = {}
+for (i = 0; i < 100; i++) {
+    big["key" + i] = i
+}
+ba.writeObject(big)
+var copy = ba.readObject()
+assert(copy.key0 == 0 && copy.key99 == 99)
+
+//  Skipped function members are not counted
+var methods = {}
+for (i = 0; i < 40; i++) {
+    methods["fn" + i] = function () {
+        return 1
+    }
+}
+ba.writeObject(methods)
+var empty = ba.readObject()
+assert(empty.fn0 == undefined)
+methods.data = 7
+ba.writeObject({inner: methods})
+assert(ba.readObject().inner.data == 7)
+
+//  Corrupt data
+ba.writeInteger(2)
+ba.writeByte(1)
+ba.writeByte(99)
+var caught
+try {
+    ba.readObject()
+} catch (e) {
+    caught = e
+}
+assert(caught is SyntaxError)
+
+//  Numbers outside the integer encoding
+var edge = [-1, -3, -9007199254740992, 9007199254740992, 1e300, -1e300, Number.POSITIVE_INFINITY, 
+    Number.NEGATIVE_INFINITY, -0.5]
+var eb = new ByteArray(64)
+eb.writeObject(edge)
+eb.writeObject(Number.NaN)
+var ec = eb.readObject()
+for (i = 0; i < edge.length; i++) {
+    assert(ec[i] === edge[i])
+}
+var nan = eb.readObject()
+assert(nan != nan)
@@ -40,7 +40,8 @@ o = {
 assert(o.length == 2)
 assert(o.name == "Peter")
 assert(o.details == "[object Object]")
-assert(serialize(o.details) == "{
+assert(serialize(o.details) == '{"location":"Australia","age":99}')
+assert(serialize(o.details, 0, false, false, true) == "{
   \"location\": \"Australia\",
   \"age\": 99
 }")
@@ -74,6 +75,9 @@ user = {
 }
 
 s = serialize(user)
+assert(s == '{"name":"Peter","age":27,"color":"blue","hobby":{"name":"Sailing"},"profession":"coder"}')
+
+s = serialize(user, 0, false, false, true)
 assert(s == '{
   \"name\": "Peter",
   \"age\": 27,
@@ -50,6 +50,8 @@ assert(hash != 0)
 //	Test serialize
 //
 s = serialize(peter)
+assert(s == '{"name":"Peter","age":27,"color":"blue"}')
+s = serialize(peter, 0, false, false, true)
 assert(s == '{
   \"name\": "Peter",
   \"age\": 27,
@@ -0,0 +1,95 @@
+/*
+ *  Test objects sharing property names (shapes)
+ */
+
+//  Same properties in the same order
+var a = {x: 1, y: 2}
+var b = {x: 3, y: 4}
+assert(a.x == 1 && a.y == 2)
+assert(b.x == 3 && b.y == 4)
+
+//  Adding a property to one object must not affect the other
+a.z = 5
+assert(a.z == 5)
+assert(b.z == undefined)
+assert(!("z" in b))
+
+//  Different order
+var c = {y: 6, x: 7}
+assert(c.x == 7 && c.y == 6)
+keys = []
+for (k in c) {
+    keys.push(k)
+}
+assert(keys == "y,x")
+
+//  Deleting from one object must not affect others with the same properties
+var d = {x: 8, y: 9}
+var e = {x: 10, y: 11}
+delete d.x
+assert(d.x == undefined)
+assert(d.y == 9)
+assert(e.x == 10)
+assert(e.y == 11)
+var f = {x: 12, y: 13}
+assert(f.x == 12)
+
+//  Properties added one at a time
+function make(i) {
+    var o = {}
+    o.id = i
+    o.name = "n" + i
+    return o
+}
+var list = []
+for (i = 0; i < 20; i++) {
+    list.push(make(i))
+}
+for (i = 0; i < 20; i++) {
+    assert(list[i].id == i)
+    assert(list[i].name == "n" + i)
+}
+
+//  Many properties (beyond the hashed threshold and shape limits)
+var big1 = {}
+var big2 = {}
+for (i = 0; i < 100; i++) {
+    big1["p" + i] = i
+    big2["p" + i] = i * 2
+}
+for (i = 0; i < 100; i++) {
+    assert(big1["p" + i] == i)
+    assert(big2["p" + i] == i * 2)
+}
+
+//  Clones share names but not values
+var g = {x: 1, y: 2}
+var h = g.clone()
+h.x = 3
+h.w = 4
+assert(g.x == 1 && h.x == 3)
+assert(g.w == undefined && h.w == 4)
+
+//  JSON objects
+var j1 = deserialize('{"a": 1, "b": 2}')
+var j2 = deserialize('{"a": 3, "b": 4}')
+assert(j1.a == 1 && j1.b == 2)
+assert(j2.a == 3 && j2.b == 4)
+assert(deserialize(serialize(j2)).b == 4)
+
+//  Deleting from objects that share names
+var full = {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8}
+var twin = {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8}
+delete full.a
+assert(full.a == undefined && full.h == 8)
+assert(twin.a == 1 && twin.h == 8)
+
+var many = {}
+for (i = 0; i < 40; i++) {
+    many["k" + i] = i
+}
+delete many.k1
+assert(many.k1 == undefined)
+assert(many.k0 == 0 && many.k39 == 39)
+many.extra = 1
+assert(many.extra == 1)
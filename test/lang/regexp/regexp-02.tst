@@ -0,0 +1,64 @@
+/*
+ *  Test regular expressions sharing compiled patterns (regex cache)
+ */
+
+//  Literals in a loop
+for (i = 0; i < 100; i++) {
+    assert(/a(b+)c/.test("xabbbcx"))
+    assert(/A(B+)C/i.exec("xabbcx")[1] == "bb")
+}
+
+//  Same pattern with different flags must not share
+var a = /abc/
+var b = /abc/i
+var c = new RegExp("abc")
+var d = new RegExp("abc", "i")
+assert(!a.test("ABC"))
+assert(b.test("ABC"))
+assert(!c.test("ABC"))
+assert(d.test("ABC"))
+assert(a == "/abc/" && b == "/abc/i")
+assert(c.source == "abc" && d.source == "abc")
+
+//  Patterns containing slashes
+var path = new RegExp("a/b")
+assert(path.test("xa/bx"))
+assert(path.source == "a/b")
+assert(/a\/b/.test("a/b"))
+
+//  Match state is per object even when the compiled pattern is shared
+var g1 = /o/g
+var g2 = /o/g
+g1.exec("foo")
+g1.exec("foo")
+g2.exec("foo")
+assert(g1.lastIndex == 3)
+assert(g2.lastIndex == 2)
+
+//  Many distinct patterns to force evictions while older objects are still live
+var list = []
+for (i = 0; i < 300; i++) {
+    list.push(new RegExp("p" + i + "x"))
+}
+GC.run()
+for (i = 0; i < 300; i++) {
+    assert(list[i].test("ap" + i + "x"))
+    assert(!list[i].test("ap" + i + "y"))
+}
+list = null
+GC.run(true)
+assert(new RegExp("p7x").test("p7x"))
+
+//  String casts
+assert(("b+" cast RegExp).test("abbc"))
+
+//  Bad patterns throw each time
+for (i = 0; i < 2; i++) {
+    let caught = false
+    try {
+        new RegExp("(abc")
+    } catch (e) {
+        caught = true
+    }
+    assert(caught)
+}
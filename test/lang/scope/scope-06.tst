@@ -0,0 +1,81 @@
+/*
+ *  Unbound names in nested functions skip the enclosing function blocks when looked up
+ */
+
+var top = 10
+implicitTop = 20
+
+function twice(x) {
+    return x * 2
+}
+
+function outer() {
+    var a = 1
+    function inner() {
+        var b = 2
+        function innermost() {
+            return a + b + top + implicitTop + twice(b)
+        }
+        return innermost()
+    }
+    return inner()
+}
+assert(outer() == 37)
+
+//  Globals defined after the function
+function later() {
+    function nested() {
+        return definedLater
+    }
+    return nested()
+}
+definedLater = "later"
+assert(later() == "later")
+
+//  Undeclared names stored in an enclosing function
+function store() {
+    implicitLocal = 3
+    function nested() {
+        return implicitLocal + 1
+    }
+    return nested()
+}
+assert(store() == 4)
+
+function count() {
+    counter++
+    function nested() {
+        return counter
+    }
+    return nested()
+}
+counter = 5
+assert(count() == 6)
+
+//  Missing names
+function missing() {
+    function nested() {
+        return notDefinedAnywhere
+    }
+    return nested()
+}
+var caught
+try {
+    missing()
+} catch (e) {
+    caught = e
+}
+assert(caught is ReferenceError)
+
+//  Methods of dynamic classes
+dynamic class Dyn {
+    var base = 40
+
+    function total() {
+        return helper() + 1
+    }
+    function helper() {
+        return base + 1
+    }
+}
+assert(new Dyn().total() == 42)
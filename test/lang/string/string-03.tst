@@ -0,0 +1,114 @@
+/*
+ *  Test building strings by repeated appends to a local variable. Strings must stay immutable.
+ */
+
+function pad(n) {
+    var s = ""
+    for (var i = 0; i < n; i++) {
+        s += "x"
+    }
+    return s
+}
+
+function build(n) {
+    var s = ""
+    for (var i = 0; i < n; i++) {
+        s += "<td>" + i + "</td>"
+    }
+    return s
+}
+
+//  Long strings
+var s = build(2000)
+assert(s.length == 24890)
+assert(s.indexOf("<td>0</td><td>1</td>") == 0)
+assert(s.slice(-13) == "<td>1999</td>")
+
+//  Saved copies must not change when the variable is appended again
+function saved() {
+    var s = pad(300)
+    var copies = []
+    for (var i = 0; i < 5; i++) {
+        copies.push(s)
+        s += "y"
+    }
+    for (i = 0; i < 5; i++) {
+        assert(copies[i].length == 300 + i)
+    }
+    var t = s
+    s += "z"
+    s += "z"
+    assert(t.length == 305)
+    assert(t[t.length - 1] == "y")
+    assert(s.length == 307)
+    return s
+}
+var r = saved()
+assert(r.length == 307)
+
+//  Reads between appends
+function reads() {
+    var s = pad(300)
+    var list = []
+    for (var i = 0; i < 10; i++) {
+        s += "a"
+        list.push(s)
+        s += "b"
+    }
+    for (i = 0; i < 10; i++) {
+        assert(list[i].length == 300 + i * 2 + 1)
+        assert(list[i][list[i].length - 1] == "a")
+    }
+}
+reads()
+
+//  The appended string used within its own expression
+function self() {
+    var s = pad(300)
+    s += s
+    assert(s.length == 600)
+    s += s.slice(0, 10)
+    assert(s.length == 610)
+    var o = {}
+    o.v = s
+    s += "q"
+    assert(o.v.length == 610)
+    assert(s.length == 611)
+}
+self()
+
+//  Values captured by closures
+function closure() {
+    var s = pad(300)
+    var get = function() {
+        return s
+    }
+    var t = get()
+    s += "w"
+    s += "w"
+    assert(t.length == 300)
+    assert(get().length == 302)
+}
+closure()
+
+//  Strings used as property names
+function names() {
+    var s = pad(300)
+    var o = {}
+    o[s] = 1
+    s += "k"
+    assert(o[pad(300)] == 1)
+    assert(o[s] == undefined)
+}
+names()
+
+//  Chained assignment
+function chained() {
+    var s = pad(300)
+    var t
+    t = s += "1"
+    s += "2"
+    assert(t.length == 301)
+    assert(s.length == 302)
+}
+chained()
@@ -0,0 +1,24 @@
+/*
+ *  Requests served by pooled interpreters must not see the state of earlier requests. The pooled virtual host is
+ *  configured in ejswebserver.conf.
+ */
+
+if (test.config["http_client"] == 1 && session["http"]) {
+
+    const HTTP = session["pool"]
+
+    for (i = 0; i < 4; i++) {
+        var first: Http = new Http
+        first.get(HTTP + "/session.ejs?user=alice")
+        assert(first.code == 200)
+        assert(first.response.contains("user=alice"))
+
+        var second: Http = new Http
+        second.get(HTTP + "/session.ejs")
+        assert(second.code == 200)
+        assert(!second.response.contains("alice"))
+    }
+
+} else {
+    test.skip("Http not enabled")
+}
@@ -0,0 +1,67 @@
+/*
+ *  Test the garbage collector. References from old objects to new objects must survive minor collections.
+ */
+
+class Holder {
+    public var item
+    public static var shared
+}
+
+function churn() {
+    for (i = 0; i < 5000; i++) {
+        var t = {a: i}
+    }
+}
+
+var old = {}
+var list = []
+var holder = new Holder
+function fn() {}
+
+//  Promote the containers to the old generation
+for (i = 0; i < 3; i++) {
+    GC.run()
+}
+
+//  Store new objects into old objects
+old.child = {value: 1}
+list.push({value: 2})
+holder.item = {value: 3}
+Holder.shared = {value: 4}
+fn.prop = {value: 5}
+function makeClosure() {
+    var captured = {value: 6}
+    return function() {
+        return captured.value
+    }
+}
+var closure = makeClosure()
+
+for (i = 0; i < 4; i++) {
+    churn()
+    GC.run()
+}
+assert(old.child.value == 1)
+assert(list[0].value == 2)
+assert(holder.item.value == 3)
+assert(Holder.shared.value == 4)
+assert(fn.prop.value == 5)
+assert(closure() == 6)
+
+//  Replace references after promotion and do a full collection
+old.child = {value: 11}
+list[0] = {value: 12}
+holder.item = {value: 13}
+churn()
+GC.run(true)
+churn()
+GC.run()
+assert(old.child.value == 11)
+assert(list[0].value == 12)
+assert(holder.item.value == 13)
+assert(Holder.shared.value == 4)
+
+//  Unreferenced old objects are reclaimed by a full collection
+old = null
+list = null
+GC.run(true)
@@ -0,0 +1,53 @@
+/*
+ *  Test the sampling profiler
+ */
+
+function fib(n) {
+    return n < 2 ? n : fib(n - 1) + fib(n - 2)
+}
+
+Profiler.reset()
+assert(!Profiler.running)
+Profiler.start(10)
+assert(Profiler.running)
+fib(15)
+Profiler.stop()
+assert(!Profiler.running)
+assert(Profiler.samples > 0)
+
+//  Collapsed stacks are "outer;inner count" lines
+var lines = Profiler.stacks.trim().split("\n")
+var total = 0, inFib = 0
+for each (line in lines) {
+    var count = line.slice(line.lastIndexOf(" ") + 1)
+    assert(count > 0)
+    total += count cast Number
+    var frames = line.slice(0, line.lastIndexOf(" ")).split(";")
+    if (frames[frames.length - 1].contains("fib")) {
+        inFib++
+    }
+}
+assert(total == Profiler.samples)
+assert(inFib > 0)
+
+//  Save
+var path = Path("profiler.tmp")
+Profiler.save(path)
+assert(path.exists)
+assert(path.readString().trim() == Profiler.stacks.trim())
+path.remove()
+
+//  Reset
+Profiler.reset()
+assert(Profiler.samples == 0)
+assert(Profiler.stacks == "")
+
+//  Bad interval
+var caught
+try {
+    Profiler.start(0)
+} catch (e) {
+    caught = e
+}
+assert(caught is ArgError)
+assert(!Profiler.running)
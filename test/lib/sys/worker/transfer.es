@@ -0,0 +1,14 @@
+/*
+ *  Transfer worker. Checks the received buffer and transfers it back.
+ */
+
+onmessage = function (e) {
+    let ba = e.data.bytes
+    assert(ba is ByteArray)
+    assert(ba.available == 8)
+    ba.writeInteger(e.data.count)
+    postMessage({bytes: ba}, [ba])
+    assert(ba.length == 0)
+    exit()
+}
+App.serviceEvents()
@@ -0,0 +1,36 @@
+/*
+ *  Transfer ByteArrays between workers
+ */
+
+var w: Worker
+
+w = new Worker("lib/sys/worker/transfer.es")
+let ba = new ByteArray(64, false)
+ba.writeInteger(1)
+ba.writeInteger(2)
+w.postMessage({bytes: ba, count: 3}, [ba])
+
+//  The transferred array is left empty
+assert(ba.length == 0)
+assert(ba.available == 0)
+
+let result = null
+w.onmessage = function (e) {
+    result = e.data.bytes
+}
+Worker.join()
+assert(result is ByteArray)
+assert(result.length == 64)
+assert(result.readInteger() == 1)
+assert(result.readInteger() == 2)
+assert(result.readInteger() == 3)
+
+//  Only ByteArrays can be transferred
+w = new Worker
+let caught
+try {
+    w.postMessage({}, [{}])
+} catch (e) {
+    caught = e
+}
+assert(caught is ArgError)
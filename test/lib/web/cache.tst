@@ -8,3 +8,11 @@ cache = new Cache
 cache.write("farm", "one", 77)
 data = cache.read("farm", "one")
 assert(data == 77)
+
+//  Values are copied with shared objects and dates preserved
+var shared = {count: 1}
+cache.write("farm", "two", {a: shared, b: shared, when: new Date(5000)})
+data = cache.read("farm", "two")
+assert(data.a === data.b)
+assert(data.a !== shared && data.a.count == 1)
+assert(data.when is Date && data.when.time == 5000)